@@ -16,6 +16,7 @@
 #include <__fwd/bit_reference.h>
 #include <__iterator/iterator_traits.h>
 #include <__iterator/segmented_iterator.h>
+#include <__iterator/strided_iterator.h>
 #include <__memory/pointer_traits.h>
 #include <__type_traits/common_type.h>
 #include <__type_traits/enable_if.h>
@@ -189,6 +190,26 @@ struct __copy_impl {
     return std::make_pair(__last, std::move(__result));
   }
 
+#if _LIBCPP_STD_VER >= 23
+  template <class _InIter,
+            class _OutIter,
+            __enable_if_t<__is_strided_iterator<_InIter>::value && !__is_segmented_iterator<_OutIter>::value, int> = 0>
+  _LIBCPP_HIDE_FROM_ABI constexpr pair<_InIter, _OutIter>
+  operator()(_InIter __first, _InIter __last, _OutIter __result) const {
+    using _Traits   = __strided_iterator_traits<_InIter>;
+    using _DiffT    = typename _Traits::difference_type;
+    auto __base     = _Traits::__base(__first);
+    _DiffT __stride = _Traits::__stride(__first);
+    _DiffT __size   = _Traits::__size(__first);
+    _DiffT __n      = __last - __first;
+    for (_DiffT __i = 0, __offset = 0; __i != __n; ++__i, __offset += __stride) {
+      *__result = _Traits::__element(__base, __offset, __stride, __size);
+      ++__result;
+    }
+    return std::make_pair(std::move(__last), std::move(__result));
+  }
+#endif // _LIBCPP_STD_VER >= 23
+
   template <class _InIter,
             class _OutIter,
             __enable_if_t<__has_random_access_iterator_category<_InIter>::value &&
@@ -10,6 +10,7 @@
 #ifndef _LIBCPP___ALGORITHM_COUNT_H
 #define _LIBCPP___ALGORITHM_COUNT_H
 
+#include <__algorithm/for_each_segment.h>
 #include <__algorithm/iterator_operations.h>
 #include <__algorithm/min.h>
 #include <__bit/invert_if.h>
@@ -18,6 +19,7 @@
 #include <__functional/identity.h>
 #include <__fwd/bit_reference.h>
 #include <__iterator/iterator_traits.h>
+#include <__iterator/segmented_iterator.h>
 #include <__type_traits/enable_if.h>
 #include <__type_traits/invoke.h>
 
@@ -81,6 +83,39 @@ __count(__bit_iterator<_Cp, _IsConst> __first, __bit_iterator<_Cp, _IsConst> __l
       __first, static_cast<typename __size_difference_type_traits<_Cp>::size_type>(__last - __first));
 }
 
+// segmented iterator implementation
+template <class _AlgPolicy, class _SegmentedIterator, class _Tp, class _Proj>
+struct _CountSegment {
+  using _Traits _LIBCPP_NODEBUG = __segmented_iterator_traits<_SegmentedIterator>;
+  using _Diff _LIBCPP_NODEBUG   = typename _IterOps<_AlgPolicy>::template __difference_type<_SegmentedIterator>;
+
+  _Diff& __result_;
+  const _Tp& __value_;
+  _Proj& __proj_;
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX14 _CountSegment(_Diff& __result, const _Tp& __value, _Proj& __proj)
+      : __result_(__result), __value_(__value), __proj_(__proj) {}
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX14 void
+  operator()(typename _Traits::__local_iterator __lfirst, typename _Traits::__local_iterator __llast) {
+    __result_ += static_cast<_Diff>(std::__count<_AlgPolicy>(__lfirst, __llast, __value_, __proj_));
+  }
+};
+
+template <class _AlgPolicy,
+          class _SegmentedIterator,
+          class _Tp,
+          class _Proj,
+          __enable_if_t<__is_segmented_iterator<_SegmentedIterator>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20
+typename _IterOps<_AlgPolicy>::template __difference_type<_SegmentedIterator>
+__count(_SegmentedIterator __first, _SegmentedIterator __last, const _Tp& __value, _Proj& __proj) {
+  typename _IterOps<_AlgPolicy>::template __difference_type<_SegmentedIterator> __r(0);
+  std::__for_each_segment(
+      __first, __last, _CountSegment<_AlgPolicy, _SegmentedIterator, _Tp, _Proj>(__r, __value, __proj));
+  return __r;
+}
+
 template <class _InputIterator, class _Tp>
 [[__nodiscard__]] inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 __iter_diff_t<_InputIterator>
 count(_InputIterator __first, _InputIterator __last, const _Tp& __value) {
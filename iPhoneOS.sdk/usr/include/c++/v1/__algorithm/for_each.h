@@ -14,6 +14,7 @@
 #include <__config>
 #include <__functional/identity.h>
 #include <__iterator/segmented_iterator.h>
+#include <__iterator/strided_iterator.h>
 #include <__type_traits/enable_if.h>
 #include <__type_traits/invoke.h>
 #include <__utility/move.h>
@@ -50,6 +51,25 @@ __for_each(_SegmentedIterator __first, _SegmentedIterator __last, _Func& __func,
 }
 #endif // !_LIBCPP_CXX03_LANG
 
+#if _LIBCPP_STD_VER >= 23
+template <class _StridedIterator,
+          class _Func,
+          class _Proj,
+          __enable_if_t<__is_strided_iterator<_StridedIterator>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI constexpr _StridedIterator
+__for_each(_StridedIterator __first, _StridedIterator __last, _Func& __func, _Proj& __proj) {
+  using _Traits   = __strided_iterator_traits<_StridedIterator>;
+  using _DiffT    = typename _Traits::difference_type;
+  auto __base     = _Traits::__base(__first);
+  _DiffT __stride = _Traits::__stride(__first);
+  _DiffT __size   = _Traits::__size(__first);
+  _DiffT __n      = __last - __first;
+  for (_DiffT __i = 0, __offset = 0; __i != __n; ++__i, __offset += __stride)
+    std::__invoke(__func, std::__invoke(__proj, _Traits::__element(__base, __offset, __stride, __size)));
+  return __last;
+}
+#endif // _LIBCPP_STD_VER >= 23
+
 template <class _InputIterator, class _Func>
 _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _Func
 for_each(_InputIterator __first, _InputIterator __last, _Func __f) {
@@ -0,0 +1,58 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ALGORITHM_FOR_EACH_SET_BIT_H
+#define _LIBCPP___ALGORITHM_FOR_EACH_SET_BIT_H
+
+#include <__bit/countr.h>
+#include <__config>
+#include <__fwd/bit_reference.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_HAS_EXPERIMENTAL_FOR_EACH_SET_BIT
+
+// Calls __f with the position, relative to __first, of every bit set in
+// [__first, __last), in increasing order. The bits are visited a word at a
+// time, so clear bits cost almost nothing.
+template <class _Cp, bool _IsConst, class _Func>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _Func
+for_each_set_bit(__bit_iterator<_Cp, _IsConst> __first, __bit_iterator<_Cp, _IsConst> __last, _Func __f) {
+  using __storage_type  = typename _Cp::__storage_type;
+  using size_type       = typename __size_difference_type_traits<_Cp>::size_type;
+  using difference_type = typename __size_difference_type_traits<_Cp>::difference_type;
+
+  const unsigned __bits_per_word = std::__bit_word_size(__first);
+  size_type __pos                = 0;
+  for (difference_type __n = __last - __first; __n > 0;) {
+    unsigned __dn = __n < static_cast<difference_type>(__bits_per_word) ? static_cast<unsigned>(__n) : __bits_per_word;
+    for (__storage_type __w = std::__load_bit_word(__first, __dn); __w != 0;
+         __w                = static_cast<__storage_type>(__w & (__w - 1)))
+      __f(static_cast<size_type>(__pos + static_cast<size_type>(std::__countr_zero(__w))));
+    __first += __dn;
+    __pos += __dn;
+    __n -= __dn;
+  }
+  return __f;
+}
+
+#endif // _LIBCPP_HAS_EXPERIMENTAL_FOR_EACH_SET_BIT
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___ALGORITHM_FOR_EACH_SET_BIT_H
@@ -14,9 +14,11 @@
 #include <__algorithm/min.h>
 #include <__algorithm/simd_utils.h>
 #include <__algorithm/unwrap_iter.h>
+#include <__bit/countr.h>
 #include <__config>
 #include <__cstddef/size_t.h>
 #include <__functional/identity.h>
+#include <__fwd/bit_reference.h>
 #include <__iterator/aliasing_iterator.h>
 #include <__iterator/iterator_traits.h>
 #include <__type_traits/desugars_to.h>
@@ -55,6 +57,44 @@ __mismatch(_Iter1 __first1, _Sent1 __last1, _Iter2 __first2, _Pred& __pred, _Pro
   return std::__mismatch_loop(__first1, __last1, __first2, __pred, __proj1, __proj2);
 }
 
+// __bit_iterator implementation
+template <class _Cp,
+          bool _IsConst1,
+          bool _IsConst2,
+          class _Pred,
+          class _Proj1,
+          class _Proj2,
+          __enable_if_t<__desugars_to_v<__equal_tag, _Pred, bool, bool> && __is_identity<_Proj1>::value &&
+                            __is_identity<_Proj2>::value,
+                        int> = 0>
+[[__nodiscard__]] _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20
+pair<__bit_iterator<_Cp, _IsConst1>, __bit_iterator<_Cp, _IsConst2> >
+__mismatch(__bit_iterator<_Cp, _IsConst1> __first1,
+           __bit_iterator<_Cp, _IsConst1> __last1,
+           __bit_iterator<_Cp, _IsConst2> __first2,
+           _Pred&,
+           _Proj1&,
+           _Proj2&) {
+  using __storage_type  = typename _Cp::__storage_type;
+  using difference_type = typename __bit_iterator<_Cp, _IsConst1>::difference_type;
+
+  const unsigned __bits_per_word = std::__bit_word_size(__first1);
+  // Compare a word worth of bits at a time, whatever the alignment of both ranges.
+  for (difference_type __n = __last1 - __first1; __n > 0;) {
+    unsigned __dn = __n < static_cast<difference_type>(__bits_per_word) ? static_cast<unsigned>(__n) : __bits_per_word;
+    __storage_type __diff =
+        static_cast<__storage_type>(std::__load_bit_word(__first1, __dn) ^ std::__load_bit_word(__first2, __dn));
+    if (__diff != 0) {
+      difference_type __offset = static_cast<difference_type>(std::__countr_zero(__diff));
+      return std::make_pair(__first1 + __offset, __first2 + __offset);
+    }
+    __first1 += __dn;
+    __first2 += __dn;
+    __n -= __dn;
+  }
+  return std::make_pair(__first1, __first2);
+}
+
 #if _LIBCPP_VECTORIZE_ALGORITHMS
 
 template <class _Iter>
@@ -185,6 +225,20 @@ __mismatch(_Tp* __first1, _Tp* __last1, _Tp* __first2, _Tp* __last2, _Pred& __pr
   return std::__mismatch(__first1, __first1 + __len, __first2, __pred, __proj1, __proj2);
 }
 
+template <class _Cp, bool _IsConst1, bool _IsConst2, class _Pred, class _Proj1, class _Proj2>
+[[__nodiscard__]] _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20
+pair<__bit_iterator<_Cp, _IsConst1>, __bit_iterator<_Cp, _IsConst2> >
+__mismatch(__bit_iterator<_Cp, _IsConst1> __first1,
+           __bit_iterator<_Cp, _IsConst1> __last1,
+           __bit_iterator<_Cp, _IsConst2> __first2,
+           __bit_iterator<_Cp, _IsConst2> __last2,
+           _Pred& __pred,
+           _Proj1& __proj1,
+           _Proj2& __proj2) {
+  auto __len = std::min(__last1 - __first1, __last2 - __first2);
+  return std::__mismatch(__first1, __first1 + __len, __first2, __pred, __proj1, __proj2);
+}
+
 template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
 [[__nodiscard__]] inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 pair<_InputIterator1, _InputIterator2>
 mismatch(_InputIterator1 __first1,
@@ -15,12 +15,14 @@
 #include <__concepts/convertible_to.h>
 #include <__concepts/invocable.h>
 #include <__concepts/movable.h>
+#include <__concepts/same_as.h>
 #include <__config>
 #include <__functional/invoke.h>
 #include <__functional/reference_wrapper.h>
 #include <__iterator/concepts.h>
 #include <__iterator/iterator_traits.h>
 #include <__iterator/next.h>
+#include <__iterator/strided_iterator.h>
 #include <__ranges/access.h>
 #include <__ranges/concepts.h>
 #include <__ranges/dangling.h>
@@ -86,12 +88,28 @@ struct __fold_left_with_iter {
       return fold_left_with_iter_result<_Ip, _Up>{std::move(__first), _Up(std::move(__init))};
     }
 
-    _Up __result = std::invoke(__f, std::move(__init), *__first);
-    for (++__first; __first != __last; ++__first) {
-      __result = std::invoke(__f, std::move(__result), *__first);
+    if constexpr (same_as<_Ip, _Sp> && __is_strided_iterator<_Ip>::value) {
+      // Index the underlying range directly instead of stepping the strided iterator.
+      using _Traits   = __strided_iterator_traits<_Ip>;
+      using _DiffT    = typename _Traits::difference_type;
+      auto __base     = _Traits::__base(__first);
+      _DiffT __stride = _Traits::__stride(__first);
+      _DiffT __size   = _Traits::__size(__first);
+      _DiffT __n      = __last - __first;
+      _Up __result    = std::invoke(__f, std::move(__init), _Traits::__element(__base, 0, __stride, __size));
+      for (_DiffT __i = 1, __offset = __stride; __i != __n; ++__i, __offset += __stride) {
+        __result = std::invoke(__f, std::move(__result), _Traits::__element(__base, __offset, __stride, __size));
+      }
+
+      return fold_left_with_iter_result<_Ip, _Up>{std::move(__last), std::move(__result)};
+    } else {
+      _Up __result = std::invoke(__f, std::move(__init), *__first);
+      for (++__first; __first != __last; ++__first) {
+        __result = std::invoke(__f, std::move(__result), *__first);
+      }
+
+      return fold_left_with_iter_result<_Ip, _Up>{std::move(__first), std::move(__result)};
     }
-
-    return fold_left_with_iter_result<_Ip, _Up>{std::move(__first), std::move(__result)};
   }
 
   template <input_range _Rp, class _Tp, __indirectly_binary_left_foldable<_Tp, iterator_t<_Rp>> _Fp>
@@ -9,22 +9,233 @@
 #ifndef _LIBCPP___ALGORITHM_TRANSFORM_H
 #define _LIBCPP___ALGORITHM_TRANSFORM_H
 
+#include <__algorithm/for_each_segment.h>
 #include <__config>
+#include <__fwd/bit_reference.h>
+#include <__iterator/segmented_iterator.h>
+#include <__type_traits/desugars_to.h>
+#include <__type_traits/enable_if.h>
+#include <__utility/move.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
 #endif
 
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
 _LIBCPP_BEGIN_NAMESPACE_STD
 
-template <class _InputIterator, class _OutputIterator, class _UnaryOperation>
-inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator
-transform(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _UnaryOperation __op) {
+template <class _InputIterator, class _Sent, class _OutputIterator, class _UnaryOperation>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator
+__transform(_InputIterator __first, _Sent __last, _OutputIterator __result, _UnaryOperation& __op) {
   for (; __first != __last; ++__first, (void)++__result)
     *__result = __op(*__first);
   return __result;
 }
 
+template <class _InputIterator1, class _Sent1, class _InputIterator2, class _OutputIterator, class _BinaryOperation>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator __transform(
+    _InputIterator1 __first1,
+    _Sent1 __last1,
+    _InputIterator2 __first2,
+    _OutputIterator __result,
+    _BinaryOperation& __binary_op) {
+  for (; __first1 != __last1; ++__first1, (void)++__first2, ++__result)
+    *__result = __binary_op(*__first1, *__first2);
+  return __result;
+}
+
+// segmented iterator implementation
+template <class _SegmentedIterator, class _OutputIterator, class _UnaryOperation>
+struct _TransformSegment {
+  using _Traits _LIBCPP_NODEBUG = __segmented_iterator_traits<_SegmentedIterator>;
+
+  _OutputIterator& __result_;
+  _UnaryOperation& __op_;
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX14
+  _TransformSegment(_OutputIterator& __result, _UnaryOperation& __op)
+      : __result_(__result), __op_(__op) {}
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 void
+  operator()(typename _Traits::__local_iterator __lfirst, typename _Traits::__local_iterator __llast) {
+    __result_ = std::__transform(__lfirst, __llast, std::move(__result_), __op_);
+  }
+};
+
+template <class _SegmentedIterator,
+          class _OutputIterator,
+          class _UnaryOperation,
+          __enable_if_t<__is_segmented_iterator<_SegmentedIterator>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator
+__transform(_SegmentedIterator __first, _SegmentedIterator __last, _OutputIterator __result, _UnaryOperation& __op) {
+  std::__for_each_segment(
+      __first, __last, _TransformSegment<_SegmentedIterator, _OutputIterator, _UnaryOperation>(__result, __op));
+  return __result;
+}
+
+template <class _SegmentedIterator, class _InputIterator2, class _OutputIterator, class _BinaryOperation>
+struct _TransformSegment2 {
+  using _Traits _LIBCPP_NODEBUG = __segmented_iterator_traits<_SegmentedIterator>;
+
+  _InputIterator2& __first2_;
+  _OutputIterator& __result_;
+  _BinaryOperation& __binary_op_;
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX14
+  _TransformSegment2(_InputIterator2& __first2, _OutputIterator& __result, _BinaryOperation& __binary_op)
+      : __first2_(__first2), __result_(__result), __binary_op_(__binary_op) {}
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 void
+  operator()(typename _Traits::__local_iterator __lfirst, typename _Traits::__local_iterator __llast) {
+    for (; __lfirst != __llast; ++__lfirst, (void)++__first2_, ++__result_)
+      *__result_ = __binary_op_(*__lfirst, *__first2_);
+  }
+};
+
+template <class _SegmentedIterator,
+          class _InputIterator2,
+          class _OutputIterator,
+          class _BinaryOperation,
+          __enable_if_t<__is_segmented_iterator<_SegmentedIterator>::value, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator
+__transform(_SegmentedIterator __first1,
+            _SegmentedIterator __last1,
+            _InputIterator2 __first2,
+            _OutputIterator __result,
+            _BinaryOperation& __binary_op) {
+  std::__for_each_segment(
+      __first1,
+      __last1,
+      _TransformSegment2<_SegmentedIterator, _InputIterator2, _OutputIterator, _BinaryOperation>(
+          __first2, __result, __binary_op));
+  return __result;
+}
+
+// __bit_iterator implementation
+//
+// The operations that act on each bit independently are applied to a word
+// worth of bits at a time, whatever the alignment of the ranges.
+
+struct __bit_word_not {
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR _Tp operator()(_Tp __x) const {
+    return static_cast<_Tp>(~__x);
+  }
+};
+
+struct __bit_word_and {
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR _Tp operator()(_Tp __x, _Tp __y) const {
+    return static_cast<_Tp>(__x & __y);
+  }
+};
+
+struct __bit_word_or {
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR _Tp operator()(_Tp __x, _Tp __y) const {
+    return static_cast<_Tp>(__x | __y);
+  }
+};
+
+struct __bit_word_xor {
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR _Tp operator()(_Tp __x, _Tp __y) const {
+    return static_cast<_Tp>(__x ^ __y);
+  }
+};
+
+struct __bit_word_xnor {
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR _Tp operator()(_Tp __x, _Tp __y) const {
+    return static_cast<_Tp>(~(__x ^ __y));
+  }
+};
+
+template <class _WordOp, class _Cp, bool _IsConst>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 __bit_iterator<_Cp, false> __transform_bool(
+    __bit_iterator<_Cp, _IsConst> __first, __bit_iterator<_Cp, _IsConst> __last, __bit_iterator<_Cp, false> __result) {
+  using difference_type = typename __bit_iterator<_Cp, _IsConst>::difference_type;
+
+  const unsigned __bits_per_word = std::__bit_word_size(__first);
+  for (difference_type __n = __last - __first; __n > 0;) {
+    unsigned __dn = __n < static_cast<difference_type>(__bits_per_word) ? static_cast<unsigned>(__n) : __bits_per_word;
+    std::__store_bit_word(__result, __dn, _WordOp()(std::__load_bit_word(__first, __dn)));
+    __first += __dn;
+    __result += __dn;
+    __n -= __dn;
+  }
+  return __result;
+}
+
+template <class _WordOp, class _Cp, bool _IsConst1, bool _IsConst2>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 __bit_iterator<_Cp, false>
+__transform_bool(__bit_iterator<_Cp, _IsConst1> __first1,
+                 __bit_iterator<_Cp, _IsConst1> __last1,
+                 __bit_iterator<_Cp, _IsConst2> __first2,
+                 __bit_iterator<_Cp, false> __result) {
+  using difference_type = typename __bit_iterator<_Cp, _IsConst1>::difference_type;
+
+  const unsigned __bits_per_word = std::__bit_word_size(__first1);
+  for (difference_type __n = __last1 - __first1; __n > 0;) {
+    unsigned __dn = __n < static_cast<difference_type>(__bits_per_word) ? static_cast<unsigned>(__n) : __bits_per_word;
+    std::__store_bit_word(
+        __result, __dn, _WordOp()(std::__load_bit_word(__first1, __dn), std::__load_bit_word(__first2, __dn)));
+    __first1 += __dn;
+    __first2 += __dn;
+    __result += __dn;
+    __n -= __dn;
+  }
+  return __result;
+}
+
+template <class _Cp,
+          bool _IsConst,
+          class _UnaryOperation,
+          __enable_if_t<__desugars_to_v<__logical_not_tag, _UnaryOperation, bool>, int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 __bit_iterator<_Cp, false>
+__transform(__bit_iterator<_Cp, _IsConst> __first,
+            __bit_iterator<_Cp, _IsConst> __last,
+            __bit_iterator<_Cp, false> __result,
+            _UnaryOperation&) {
+  return std::__transform_bool<__bit_word_not>(__first, __last, __result);
+}
+
+template <class _Cp,
+          bool _IsConst1,
+          bool _IsConst2,
+          class _BinaryOperation,
+          __enable_if_t<__desugars_to_v<__bit_and_tag, _BinaryOperation, bool, bool> ||
+                            __desugars_to_v<__logical_and_tag, _BinaryOperation, bool, bool> ||
+                            __desugars_to_v<__bit_or_tag, _BinaryOperation, bool, bool> ||
+                            __desugars_to_v<__logical_or_tag, _BinaryOperation, bool, bool> ||
+                            __desugars_to_v<__bit_xor_tag, _BinaryOperation, bool, bool> ||
+                            __desugars_to_v<__equal_tag, _BinaryOperation, bool, bool>,
+                        int> = 0>
+_LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 __bit_iterator<_Cp, false>
+__transform(__bit_iterator<_Cp, _IsConst1> __first1,
+            __bit_iterator<_Cp, _IsConst1> __last1,
+            __bit_iterator<_Cp, _IsConst2> __first2,
+            __bit_iterator<_Cp, false> __result,
+            _BinaryOperation&) {
+  if (__desugars_to_v<__bit_and_tag, _BinaryOperation, bool, bool> ||
+      __desugars_to_v<__logical_and_tag, _BinaryOperation, bool, bool>)
+    return std::__transform_bool<__bit_word_and>(__first1, __last1, __first2, __result);
+  if (__desugars_to_v<__bit_or_tag, _BinaryOperation, bool, bool> ||
+      __desugars_to_v<__logical_or_tag, _BinaryOperation, bool, bool>)
+    return std::__transform_bool<__bit_word_or>(__first1, __last1, __first2, __result);
+  if (__desugars_to_v<__bit_xor_tag, _BinaryOperation, bool, bool>)
+    return std::__transform_bool<__bit_word_xor>(__first1, __last1, __first2, __result);
+  return std::__transform_bool<__bit_word_xnor>(__first1, __last1, __first2, __result);
+}
+
+template <class _InputIterator, class _OutputIterator, class _UnaryOperation>
+inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator
+transform(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _UnaryOperation __op) {
+  return std::__transform(__first, __last, __result, __op);
+}
+
 template <class _InputIterator1, class _InputIterator2, class _OutputIterator, class _BinaryOperation>
 inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator transform(
     _InputIterator1 __first1,
@@ -32,11 +243,11 @@ inline _LIBCPP_HIDE_FROM_ABI _LIBCPP_CONSTEXPR_SINCE_CXX20 _OutputIterator trans
     _InputIterator2 __first2,
     _OutputIterator __result,
     _BinaryOperation __binary_op) {
-  for (; __first1 != __last1; ++__first1, (void)++__first2, ++__result)
-    *__result = __binary_op(*__first1, *__first2);
-  return __result;
+  return std::__transform(__first1, __last1, __first2, __result, __binary_op);
 }
 
 _LIBCPP_END_NAMESPACE_STD
 
+_LIBCPP_POP_MACROS
+
 #endif // _LIBCPP___ALGORITHM_TRANSFORM_H
@@ -0,0 +1,88 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___CHARCONV_FROM_CHARS_BULK_H
+#define _LIBCPP___CHARCONV_FROM_CHARS_BULK_H
+
+#include <__charconv/chars_format.h>
+#include <__charconv/from_chars_floating_point.h>
+#include <__charconv/from_chars_integral.h>
+#include <__charconv/from_chars_result.h>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__system_error/errc.h>
+#include <__type_traits/is_arithmetic.h>
+#include <__type_traits/is_same.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_FROM_CHARS_BULK
+
+struct from_chars_bulk_result {
+  const char* ptr;
+  size_t count;
+  errc ec;
+#  if _LIBCPP_STD_VER >= 20
+  _LIBCPP_HIDE_FROM_ABI friend bool operator==(const from_chars_bulk_result&, const from_chars_bulk_result&) = default;
+#  endif
+};
+
+// Parses the delimited sequence of numbers in [__first, __last) into the
+// array [__out, __out + __n).
+//
+// Blanks (space, tab, carriage return and line feed) around the delimiters
+// are ignored, unless they are the delimiter. A trailing delimiter is allowed.
+// Parsing stops at the first malformed number, at the end of the input, or
+// when the output is full; in the latter case ptr points to the start of the
+// next number, so the call can be resumed with a new output array.
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI from_chars_bulk_result
+from_chars_bulk(const char* __first, const char* __last, _Tp* __out, size_t __n, char __delimiter = ',') {
+  static_assert(is_arithmetic<_Tp>::value && !is_same<_Tp, bool>::value,
+                "from_chars_bulk requires an integral or floating-point type");
+
+  auto __skip_blanks = [__delimiter, __last](const char* __p) {
+    for (; __p != __last && *__p != __delimiter; ++__p)
+      if (*__p != ' ' && *__p != '\t' && *__p != '\r' && *__p != '\n')
+        break;
+    return __p;
+  };
+
+  const char* __p = __skip_blanks(__first);
+  size_t __count  = 0;
+  while (__p != __last && __count != __n) {
+    from_chars_result __r = std::from_chars(__p, __last, __out[__count]);
+    if (__r.ec != errc{})
+      return {__p, __count, __r.ec};
+    ++__count;
+
+    __p = __skip_blanks(__r.ptr);
+    if (__p == __last)
+      break;
+    if (*__p != __delimiter)
+      return {__p, __count, errc::invalid_argument};
+    __p = __skip_blanks(__p + 1);
+  }
+  return {__p, __count, errc{}};
+}
+
+#endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_FROM_CHARS_BULK
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___CHARCONV_FROM_CHARS_BULK_H
@@ -11,11 +11,16 @@
 #define _LIBCPP___CHARCONV_FROM_CHARS_FLOATING_POINT_H
 
 #include <__assert>
+#include <__bit/bit_cast.h>
+#include <__bit/countl.h>
 #include <__charconv/chars_format.h>
 #include <__charconv/from_chars_result.h>
+#include <__charconv/swar.h>
+#include <__charconv/tables.h>
 #include <__config>
 #include <__cstddef/ptrdiff_t.h>
 #include <__system_error/errc.h>
+#include <cstdint>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -45,9 +50,251 @@ extern template __from_chars_result<float> __from_chars_floating_point(
 extern template __from_chars_result<double> __from_chars_floating_point(
     _LIBCPP_NOESCAPE const char* __first, _LIBCPP_NOESCAPE const char* __last, chars_format __fmt);
 
+// Header-visible fast path for decimal input.
+//
+// Decimal numbers with at most 19 significant digits are parsed in
+// __mantissa * 10^__exponent form and converted using Clinger's exact
+// fast path or the Eisel-Lemire algorithm, see
+//   Daniel Lemire, "Number Parsing at a Gigabyte per Second",
+//   Software: Practice and Experience 51 (8), 2021.
+// Everything else (hexadecimal input, infinities, NaNs, too many digits, and
+// results that are subnormal or out of range) is handled by the library.
+
+template <class _Fp>
+struct __from_chars_binary_format;
+
+template <>
+struct __from_chars_binary_format<float> {
+  using __bits_type = uint32_t;
+
+  static constexpr int __mantissa_bits          = 23;
+  static constexpr int __minimum_exponent       = -127;
+  static constexpr int __infinite_power         = 0xFF;
+  static constexpr int __smallest_power_of_ten  = -64;
+  static constexpr int __largest_power_of_ten   = 38;
+  static constexpr int __min_round_to_even      = -17;
+  static constexpr int __max_round_to_even      = 10;
+  static constexpr int __max_exact_power_of_ten = 10;
+
+  static _LIBCPP_HIDE_FROM_ABI float __exact_power_of_ten(int __e) {
+    constexpr float __pow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    return __pow10[__e];
+  }
+};
+
+template <>
+struct __from_chars_binary_format<double> {
+  using __bits_type = uint64_t;
+
+  static constexpr int __mantissa_bits          = 52;
+  static constexpr int __minimum_exponent       = -1023;
+  static constexpr int __infinite_power         = 0x7FF;
+  static constexpr int __smallest_power_of_ten  = -342;
+  static constexpr int __largest_power_of_ten   = 308;
+  static constexpr int __min_round_to_even      = -4;
+  static constexpr int __max_round_to_even      = 23;
+  static constexpr int __max_exact_power_of_ten = 22;
+
+  static _LIBCPP_HIDE_FROM_ABI double __exact_power_of_ten(int __e) {
+    constexpr double __pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    return __pow10[__e];
+  }
+};
+
+struct __from_chars_decimal {
+  uint64_t __mantissa;
+  int64_t __exponent;
+  bool __negative;
+  const char* __ptr;
+};
+
+// Accumulates the digits at __p in __mantissa.
+//
+// Returns false when the number has more significant digits than fit in
+// __mantissa.
+_LIBCPP_HIDE_FROM_ABI inline bool
+__from_chars_decimal_digits(const char*& __p, const char* __last, uint64_t& __mantissa, int& __digits) {
+  uint32_t __v8;
+  for (; __digits <= 11 && __itoa::__swar_try_parse_eight_digits(__p, __last, __v8); __digits += 8, __p += 8)
+    __mantissa = __mantissa * 100000000 + __v8;
+
+  for (; __p != __last && '0' <= *__p && *__p <= '9'; ++__digits, ++__p) {
+    if (__digits == 19)
+      return false;
+    __mantissa = __mantissa * 10 + static_cast<uint64_t>(*__p - '0');
+  }
+  return true;
+}
+
+// Parses the subject sequence of a decimal number for the fast path.
+//
+// Returns false when the input needs to be handled by the library.
+_LIBCPP_HIDE_FROM_ABI inline bool
+__from_chars_parse_decimal(const char* __first, const char* __last, chars_format __fmt, __from_chars_decimal& __d) {
+  if (__fmt != chars_format::general && __fmt != chars_format::fixed && __fmt != chars_format::scientific)
+    return false;
+
+  const char* __p = __first;
+  __d.__negative  = __p != __last && *__p == '-';
+  if (__d.__negative)
+    ++__p;
+
+  __d.__mantissa = 0;
+  __d.__exponent = 0;
+  int __digits   = 0;
+
+  const char* __integral = __p;
+  for (; __p != __last && *__p == '0'; ++__p)
+    ;
+  if (!std::__from_chars_decimal_digits(__p, __last, __d.__mantissa, __digits))
+    return false;
+  bool __has_digits = __p != __integral;
+
+  if (__p != __last && *__p == '.') {
+    const char* __fraction = ++__p;
+    if (__digits == 0)
+      for (; __p != __last && *__p == '0'; ++__p)
+        ;
+    if (!std::__from_chars_decimal_digits(__p, __last, __d.__mantissa, __digits))
+      return false;
+    __d.__exponent = -(__p - __fraction);
+    __has_digits |= __p != __fraction;
+  }
+
+  if (!__has_digits)
+    return false;
+
+  if ((__fmt & chars_format::scientific) == chars_format::scientific) {
+    bool __has_exponent = false;
+    if (__p != __last && (*__p == 'e' || *__p == 'E')) {
+      const char* __e          = __p + 1;
+      bool __negative_exponent = __e != __last && *__e == '-';
+      if (__e != __last && (*__e == '-' || *__e == '+'))
+        ++__e;
+      if (__e != __last && '0' <= *__e && *__e <= '9') {
+        int64_t __exponent = 0;
+        for (; __e != __last && '0' <= *__e && *__e <= '9'; ++__e)
+          if (__exponent < 0x10000) // Larger exponents saturate, only their sign matters.
+            __exponent = __exponent * 10 + (*__e - '0');
+        __d.__exponent += __negative_exponent ? -__exponent : __exponent;
+        __p            = __e;
+        __has_exponent = true;
+      }
+    }
+    if (!__has_exponent && __fmt == chars_format::scientific)
+      return false;
+  }
+
+  __d.__ptr = __p;
+  return true;
+}
+
+// Returns the product of __a and __b as a {high, low} pair.
+_LIBCPP_HIDE_FROM_ABI inline void __from_chars_mul_64(uint64_t __a, uint64_t __b, uint64_t& __hi, uint64_t& __lo) {
+#  if _LIBCPP_HAS_INT128
+  __uint128_t __r = static_cast<__uint128_t>(__a) * __b;
+  __hi            = static_cast<uint64_t>(__r >> 64);
+  __lo            = static_cast<uint64_t>(__r);
+#  else
+  uint64_t __a_lo = static_cast<uint32_t>(__a), __a_hi = __a >> 32;
+  uint64_t __b_lo = static_cast<uint32_t>(__b), __b_hi = __b >> 32;
+  uint64_t __ll   = __a_lo * __b_lo;
+  uint64_t __lh   = __a_lo * __b_hi;
+  uint64_t __hl   = __a_hi * __b_lo;
+  uint64_t __hh   = __a_hi * __b_hi;
+  uint64_t __mid  = (__ll >> 32) + static_cast<uint32_t>(__lh) + static_cast<uint32_t>(__hl);
+  __hi            = __hh + (__lh >> 32) + (__hl >> 32) + (__mid >> 32);
+  __lo            = (__mid << 32) | static_cast<uint32_t>(__ll);
+#  endif
+}
+
+// Converts __w * 10^__q to the nearest _Fp.
+//
+// Returns false when the result is subnormal or out of range; these cases
+// are rare in practice and are left to the library.
+template <class _Fp>
+_LIBCPP_HIDE_FROM_ABI bool __from_chars_eisel_lemire(uint64_t __w, int64_t __q, bool __negative, _Fp& __value) {
+  using __traits    = __from_chars_binary_format<_Fp>;
+  using __bits_type = typename __traits::__bits_type;
+
+  if (__w == 0) {
+    __value = __negative ? -_Fp(0) : _Fp(0);
+    return true;
+  }
+
+#  if defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+  // Clinger's fast path: both the mantissa and the power of ten are exact,
+  // so a single correctly rounded IEEE operation gives the correct result.
+  if (-__traits::__max_exact_power_of_ten <= __q && __q <= __traits::__max_exact_power_of_ten &&
+      __w <= (uint64_t(2) << __traits::__mantissa_bits)) {
+    _Fp __v = static_cast<_Fp>(__w);
+    if (__q < 0)
+      __v /= __traits::__exact_power_of_ten(static_cast<int>(-__q));
+    else
+      __v *= __traits::__exact_power_of_ten(static_cast<int>(__q));
+    __value = __negative ? -__v : __v;
+    return true;
+  }
+#  endif
+
+  if (__q < __traits::__smallest_power_of_ten || __q > __traits::__largest_power_of_ten)
+    return false;
+
+  int __lz = std::__countl_zero(__w);
+  __w <<= __lz;
+
+  // Multiply by the truncated 128-bit power of five; the second half is only
+  // needed when the bits below the mantissa and its rounding bits are all set.
+  const int __index = 2 * static_cast<int>(__q - __itoa::__pow5_128_min_exponent);
+  uint64_t __hi, __lo;
+  std::__from_chars_mul_64(__w, __itoa::__pow5_128[__index], __hi, __lo);
+  const uint64_t __precision_mask = ~uint64_t(0) >> (__traits::__mantissa_bits + 3);
+  if ((__hi & __precision_mask) == __precision_mask) {
+    uint64_t __hi2, __lo2;
+    std::__from_chars_mul_64(__w, __itoa::__pow5_128[__index + 1], __hi2, __lo2);
+    __lo += __hi2;
+    if (__hi2 > __lo)
+      ++__hi;
+  }
+
+  int __upperbit   = static_cast<int>(__hi >> 63);
+  int __shift      = __upperbit + 64 - __traits::__mantissa_bits - 3;
+  uint64_t __m     = __hi >> __shift;
+  int64_t __power2 = (((152170 + 65536) * __q) >> 16) + 63 + __upperbit - __lz - __traits::__minimum_exponent;
+  if (__power2 <= 0)
+    return false;
+
+  // Ties are rounded to even; a tie is only possible for small exponents.
+  if (__lo <= 1 && __traits::__min_round_to_even <= __q && __q <= __traits::__max_round_to_even && (__m & 3) == 1 &&
+      (__m << __shift) == __hi)
+    __m &= ~uint64_t(1);
+
+  __m += __m & 1;
+  __m >>= 1;
+  if (__m >= (uint64_t(2) << __traits::__mantissa_bits)) {
+    __m = uint64_t(1) << __traits::__mantissa_bits;
+    ++__power2;
+  }
+  __m &= ~(uint64_t(1) << __traits::__mantissa_bits);
+  if (__power2 >= __traits::__infinite_power)
+    return false;
+
+  __bits_type __bits = static_cast<__bits_type>(__m) |
+                       (static_cast<__bits_type>(__power2) << __traits::__mantissa_bits) |
+                       (static_cast<__bits_type>(__negative) << (sizeof(__bits_type) * 8 - 1));
+  __value = std::__bit_cast<_Fp>(__bits);
+  return true;
+}
+
 template <class _Fp>
 _LIBCPP_HIDE_FROM_ABI from_chars_result
 __from_chars(const char* __first, const char* __last, _Fp& __value, chars_format __fmt) {
+  __from_chars_decimal __d;
+  if (std::__from_chars_parse_decimal(__first, __last, __fmt, __d) &&
+      std::__from_chars_eisel_lemire(__d.__mantissa, __d.__exponent, __d.__negative, __value))
+    return {__d.__ptr, errc{}};
+
   __from_chars_result<_Fp> __r = std::__from_chars_floating_point<_Fp>(__first, __last, __fmt);
   if (__r.__ec != errc::invalid_argument)
     __value = __r.__value;
@@ -13,6 +13,7 @@
 #include <__algorithm/copy_n.h>
 #include <__assert>
 #include <__charconv/from_chars_result.h>
+#include <__charconv/swar.h>
 #include <__charconv/traits.h>
 #include <__config>
 #include <__memory/addressof.h>
@@ -125,25 +126,73 @@ __subject_seq_combinator(_It __first, _It __last, _Tp& __value, _Fn __f, _Ts...
   return __r;
 }
 
+// Reads the base 10 digits of an unsigned value of at least 32 bits.
+//
+// Any sequence of at most digits10 digits fits in _Tp, so these digits are
+// accumulated without overflow checks; runs of sixteen and eight digits are
+// converted at once using SWAR. Only a final additional digit needs to be
+// checked for overflow.
+//
+// precondition: __p points to a non-zero digit
+template <typename _Tp>
+inline _LIBCPP_CONSTEXPR_SINCE_CXX23 _LIBCPP_HIDE_FROM_ABI from_chars_result
+__from_chars_atoi_swar(const char* __p, const char* __ep, _Tp& __val) {
+  constexpr int __safe_digits = numeric_limits<_Tp>::digits10;
+  _Tp __x                     = 0;
+  int __n                     = 0;
+
+  if constexpr (__safe_digits >= 16) {
+    uint64_t __v16;
+    if (__itoa::__swar_try_parse_sixteen_digits(__p, __ep, __v16)) {
+      __x = __v16;
+      __n = 16;
+      __p += 16;
+    }
+  }
+
+  uint32_t __v8;
+  for (; __n + 8 <= __safe_digits && __itoa::__swar_try_parse_eight_digits(__p, __ep, __v8); __n += 8, __p += 8)
+    __x = __x * 100000000 + __v8;
+
+  for (; __n < __safe_digits && __p != __ep && std::__in_pattern(*__p); ++__n, ++__p)
+    __x = __x * 10 + static_cast<_Tp>(*__p - '0');
+
+  if (__p != __ep && std::__in_pattern(*__p)) {
+    if (__itoa::__mul_overflowed(__x, 10, __x) ||
+        __builtin_add_overflow(__x, static_cast<_Tp>(*__p - '0'), std::addressof(__x)))
+      return {__p, errc::result_out_of_range};
+
+    if (++__p != __ep && std::__in_pattern(*__p))
+      return {__p, errc::result_out_of_range};
+  }
+
+  __val = __x;
+  return {__p, {}};
+}
+
 template <typename _Tp, __enable_if_t<is_unsigned<_Tp>::value, int> = 0>
 inline _LIBCPP_CONSTEXPR_SINCE_CXX23 _LIBCPP_HIDE_FROM_ABI from_chars_result
 __from_chars_atoi(const char* __first, const char* __last, _Tp& __value) {
   using __tx          = __itoa::__traits<_Tp>;
   using __output_type = typename __tx::type;
 
-  return std::__subject_seq_combinator(
-      __first, __last, __value, [](const char* __f, const char* __l, _Tp& __val) -> from_chars_result {
-        __output_type __a, __b;
-        auto __p = __tx::__read(__f, __l, __a, __b);
-        if (__p == __l || !std::__in_pattern(*__p)) {
-          __output_type __m = numeric_limits<_Tp>::max();
-          if (__m >= __a && __m - __a >= __b) {
-            __val = __a + __b;
-            return {__p, {}};
+  if constexpr (sizeof(_Tp) >= sizeof(uint32_t)) {
+    return std::__subject_seq_combinator(__first, __last, __value, __from_chars_atoi_swar<_Tp>);
+  } else {
+    return std::__subject_seq_combinator(
+        __first, __last, __value, [](const char* __f, const char* __l, _Tp& __val) -> from_chars_result {
+          __output_type __a, __b;
+          auto __p = __tx::__read(__f, __l, __a, __b);
+          if (__p == __l || !std::__in_pattern(*__p)) {
+            __output_type __m = numeric_limits<_Tp>::max();
+            if (__m >= __a && __m - __a >= __b) {
+              __val = __a + __b;
+              return {__p, {}};
+            }
           }
-        }
-        return {__p, errc::result_out_of_range};
-      });
+          return {__p, errc::result_out_of_range};
+        });
+  }
 }
 
 template <typename _Tp, __enable_if_t<is_signed<_Tp>::value, int> = 0>
@@ -0,0 +1,371 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___CHARCONV_RYU_H
+#define _LIBCPP___CHARCONV_RYU_H
+
+#include <__assert>
+#include <__charconv/tables.h>
+#include <__config>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 17
+
+// Header-only implementation of the Ryu shortest round-trip conversion, see
+//   Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018.
+//
+// __d2d and __f2d return the shortest decimal __mantissa * 10^__exponent that
+// parses back to the given value, selecting the one closest to the exact value
+// when there are several candidates. The step numbers in the comments refer
+// to the paper.
+namespace __ryu {
+
+struct __floating_decimal_64 {
+  uint64_t __mantissa;
+  int32_t __exponent;
+};
+
+struct __floating_decimal_32 {
+  uint32_t __mantissa;
+  int32_t __exponent;
+};
+
+// Returns ceil(log2(5^__e)), or 1 for __e == 0. Valid for __e in [0, 3528].
+_LIBCPP_HIDE_FROM_ABI inline int32_t __pow5bits(int32_t __e) {
+  _LIBCPP_ASSERT_INTERNAL(__e >= 0 && __e <= 3528, "Exponent out of range");
+  return static_cast<int32_t>((static_cast<uint32_t>(__e) * 1217359) >> 19) + 1;
+}
+
+// Returns floor(log10(2^__e)). Valid for __e in [0, 1650].
+_LIBCPP_HIDE_FROM_ABI inline uint32_t __log10_pow2(int32_t __e) {
+  _LIBCPP_ASSERT_INTERNAL(__e >= 0 && __e <= 1650, "Exponent out of range");
+  return (static_cast<uint32_t>(__e) * 78913) >> 18;
+}
+
+// Returns floor(log10(5^__e)). Valid for __e in [0, 2620].
+_LIBCPP_HIDE_FROM_ABI inline uint32_t __log10_pow5(int32_t __e) {
+  _LIBCPP_ASSERT_INTERNAL(__e >= 0 && __e <= 2620, "Exponent out of range");
+  return (static_cast<uint32_t>(__e) * 732923) >> 20;
+}
+
+template <class _Up>
+_LIBCPP_HIDE_FROM_ABI bool __multiple_of_power_of_5(_Up __value, uint32_t __p) {
+  uint32_t __count = 0;
+  for (; __value % 5 == 0; __value /= 5)
+    ++__count;
+  return __count >= __p;
+}
+
+template <class _Up>
+_LIBCPP_HIDE_FROM_ABI bool __multiple_of_power_of_2(_Up __value, uint32_t __p) {
+  _LIBCPP_ASSERT_INTERNAL(__p < sizeof(_Up) * 8, "Shift out of range");
+  return (__value & ((_Up(1) << __p) - 1)) == 0;
+}
+
+// Returns the bits [__j, __j + 64) of __m * __mul, where __mul is the
+// 128-bit value {low, high}.
+_LIBCPP_HIDE_FROM_ABI inline uint64_t __mul_shift_64(uint64_t __m, const uint64_t* __mul, int32_t __j) {
+  _LIBCPP_ASSERT_INTERNAL(__j > 64 && __j < 128, "Shift out of range");
+#  if _LIBCPP_HAS_INT128
+  const __uint128_t __b0 = static_cast<__uint128_t>(__m) * __mul[0];
+  const __uint128_t __b2 = static_cast<__uint128_t>(__m) * __mul[1];
+  return static_cast<uint64_t>(((__b0 >> 64) + __b2) >> (__j - 64));
+#  else
+  auto __umul128 = [](uint64_t __a, uint64_t __b, uint64_t& __hi) -> uint64_t {
+    uint64_t __a_lo = static_cast<uint32_t>(__a), __a_hi = __a >> 32;
+    uint64_t __b_lo = static_cast<uint32_t>(__b), __b_hi = __b >> 32;
+    uint64_t __ll   = __a_lo * __b_lo;
+    uint64_t __lh   = __a_lo * __b_hi;
+    uint64_t __hl   = __a_hi * __b_lo;
+    uint64_t __mid  = (__ll >> 32) + static_cast<uint32_t>(__lh) + static_cast<uint32_t>(__hl);
+    __hi            = __a_hi * __b_hi + (__lh >> 32) + (__hl >> 32) + (__mid >> 32);
+    return (__mid << 32) | static_cast<uint32_t>(__ll);
+  };
+  uint64_t __high0, __high1;
+  __umul128(__m, __mul[0], __high0);
+  const uint64_t __low1 = __umul128(__m, __mul[1], __high1);
+  const uint64_t __sum  = __high0 + __low1;
+  if (__sum < __high0)
+    ++__high1;
+  const int32_t __dist = __j - 64;
+  return (__high1 << (64 - __dist)) | (__sum >> __dist);
+#  endif
+}
+
+_LIBCPP_HIDE_FROM_ABI inline __floating_decimal_64 __d2d(uint64_t __ieee_mantissa, uint32_t __ieee_exponent) {
+  const int __mantissa_bits = 52;
+  const int __bias          = 1023;
+
+  int32_t __e2;
+  uint64_t __m2;
+  if (__ieee_exponent == 0) {
+    // Subtract 2 so that the bounds computation has 2 additional bits.
+    __e2 = 1 - __bias - __mantissa_bits - 2;
+    __m2 = __ieee_mantissa;
+  } else {
+    __e2 = static_cast<int32_t>(__ieee_exponent) - __bias - __mantissa_bits - 2;
+    __m2 = (uint64_t(1) << __mantissa_bits) | __ieee_mantissa;
+  }
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  // Step 2: Determine the interval of valid decimal representations.
+  const uint64_t __mv       = 4 * __m2;
+  const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+
+  // Step 3: Convert to a decimal power base using 128-bit arithmetic.
+  uint64_t __vr, __vp, __vm;
+  int32_t __e10;
+  bool __vm_is_trailing_zeros = false;
+  bool __vr_is_trailing_zeros = false;
+  if (__e2 >= 0) {
+    const uint32_t __q = __ryu::__log10_pow2(__e2) - (__e2 > 3);
+    __e10              = static_cast<int32_t>(__q);
+    const int32_t __k  = __itoa::__ryu_double_pow5_inv_bitcount + __ryu::__pow5bits(static_cast<int32_t>(__q)) - 1;
+    const int32_t __i  = -__e2 + static_cast<int32_t>(__q) + __k;
+    const uint64_t* __mul = __itoa::__ryu_double_pow5_inv_split[__q];
+    __vr                  = __ryu::__mul_shift_64(4 * __m2, __mul, __i);
+    __vp                  = __ryu::__mul_shift_64(4 * __m2 + 2, __mul, __i);
+    __vm                  = __ryu::__mul_shift_64(4 * __m2 - 1 - __mm_shift, __mul, __i);
+    if (__q <= 21) {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (__mv % 5 == 0)
+        __vr_is_trailing_zeros = __ryu::__multiple_of_power_of_5(__mv, __q);
+      else if (__accept_bounds)
+        __vm_is_trailing_zeros = __ryu::__multiple_of_power_of_5(__mv - 1 - __mm_shift, __q);
+      else
+        __vp -= __ryu::__multiple_of_power_of_5(__mv + 2, __q);
+    }
+  } else {
+    const uint32_t __q = __ryu::__log10_pow5(-__e2) - (-__e2 > 1);
+    __e10              = static_cast<int32_t>(__q) + __e2;
+    const int32_t __i  = -__e2 - static_cast<int32_t>(__q);
+    const int32_t __k  = __ryu::__pow5bits(__i) - __itoa::__ryu_double_pow5_bitcount;
+    const int32_t __j  = static_cast<int32_t>(__q) - __k;
+    const uint64_t* __mul = __itoa::__ryu_double_pow5_split[__i];
+    __vr                  = __ryu::__mul_shift_64(4 * __m2, __mul, __j);
+    __vp                  = __ryu::__mul_shift_64(4 * __m2 + 2, __mul, __j);
+    __vm                  = __ryu::__mul_shift_64(4 * __m2 - 1 - __mm_shift, __mul, __j);
+    if (__q <= 1) {
+      // mv = 4 * m2, so it always has at least two trailing 0 bits.
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+        // mm = mv - 1 - mm_shift, so it has 1 trailing 0 bit iff mm_shift == 1.
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      else
+        // mp = mv + 2, so it always has at least one trailing 0 bit.
+        --__vp;
+    } else if (__q < 63) {
+      __vr_is_trailing_zeros = __ryu::__multiple_of_power_of_2(__mv, __q);
+    }
+  }
+
+  // Step 4: Find the shortest decimal representation in the interval of valid representations.
+  int32_t __removed            = 0;
+  uint8_t __last_removed_digit = 0;
+  uint64_t __output;
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros) {
+    // General case, which happens rarely (~0.7%).
+    for (; __vp / 10 > __vm / 10; ++__removed) {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+    if (__vm_is_trailing_zeros) {
+      for (; __vm % 10 == 0; ++__removed) {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+      // Round even if the exact number is .....50..0.
+      __last_removed_digit = 4;
+    // We need to take vr + 1 if vr is outside bounds or we need to round up.
+    __output = __vr + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  } else {
+    // Specialized for the common case (~99.3%).
+    bool __round_up = false;
+    if (__vp / 100 > __vm / 100) {
+      // Optimization: remove two digits at a time (~86.2%).
+      __round_up = __vr % 100 >= 50;
+      __vr /= 100;
+      __vp /= 100;
+      __vm /= 100;
+      __removed += 2;
+    }
+    for (; __vp / 10 > __vm / 10; ++__removed) {
+      __round_up = __vr % 10 >= 5;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+    // We need to take vr + 1 if vr is outside bounds or we need to round up.
+    __output = __vr + (__vr == __vm || __round_up);
+  }
+
+  return {__output, __e10 + __removed};
+}
+
+// Returns the bits [__shift, __shift + 32) of __m * __factor.
+_LIBCPP_HIDE_FROM_ABI inline uint32_t __mul_shift_32(uint32_t __m, uint64_t __factor, int32_t __shift) {
+  _LIBCPP_ASSERT_INTERNAL(__shift > 32, "Shift out of range");
+  const uint64_t __bits0 = static_cast<uint64_t>(__m) * static_cast<uint32_t>(__factor);
+  const uint64_t __bits1 = static_cast<uint64_t>(__m) * static_cast<uint32_t>(__factor >> 32);
+  return static_cast<uint32_t>(((__bits0 >> 32) + __bits1) >> (__shift - 32));
+}
+
+_LIBCPP_HIDE_FROM_ABI inline __floating_decimal_32 __f2d(uint32_t __ieee_mantissa, uint32_t __ieee_exponent) {
+  const int __mantissa_bits = 23;
+  const int __bias          = 127;
+
+  int32_t __e2;
+  uint32_t __m2;
+  if (__ieee_exponent == 0) {
+    // Subtract 2 so that the bounds computation has 2 additional bits.
+    __e2 = 1 - __bias - __mantissa_bits - 2;
+    __m2 = __ieee_mantissa;
+  } else {
+    __e2 = static_cast<int32_t>(__ieee_exponent) - __bias - __mantissa_bits - 2;
+    __m2 = (uint32_t(1) << __mantissa_bits) | __ieee_mantissa;
+  }
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  // Step 2: Determine the interval of valid decimal representations.
+  const uint32_t __mv       = 4 * __m2;
+  const uint32_t __mp       = 4 * __m2 + 2;
+  const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+  const uint32_t __mm       = 4 * __m2 - 1 - __mm_shift;
+
+  // Step 3: Convert to a decimal power base using 64-bit arithmetic.
+  uint32_t __vr, __vp, __vm;
+  int32_t __e10;
+  bool __vm_is_trailing_zeros  = false;
+  bool __vr_is_trailing_zeros  = false;
+  uint8_t __last_removed_digit = 0;
+  if (__e2 >= 0) {
+    const uint32_t __q = __ryu::__log10_pow2(__e2);
+    __e10              = static_cast<int32_t>(__q);
+    const int32_t __k  = __itoa::__ryu_float_pow5_inv_bitcount + __ryu::__pow5bits(static_cast<int32_t>(__q)) - 1;
+    const int32_t __i  = -__e2 + static_cast<int32_t>(__q) + __k;
+    __vr               = __ryu::__mul_shift_32(__mv, __itoa::__ryu_float_pow5_inv_split[__q], __i);
+    __vp               = __ryu::__mul_shift_32(__mp, __itoa::__ryu_float_pow5_inv_split[__q], __i);
+    __vm               = __ryu::__mul_shift_32(__mm, __itoa::__ryu_float_pow5_inv_split[__q], __i);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10) {
+      // We need to know one removed digit even if we are not going to loop
+      // below. We could use q = X - 1 above, except that would require 33 bits
+      // for the result.
+      const int32_t __l =
+          __itoa::__ryu_float_pow5_inv_bitcount + __ryu::__pow5bits(static_cast<int32_t>(__q - 1)) - 1;
+      __last_removed_digit = static_cast<uint8_t>(
+          __ryu::__mul_shift_32(
+              __mv, __itoa::__ryu_float_pow5_inv_split[__q - 1], -__e2 + static_cast<int32_t>(__q) - 1 + __l) %
+          10);
+    }
+    if (__q <= 9) {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (__mv % 5 == 0)
+        __vr_is_trailing_zeros = __ryu::__multiple_of_power_of_5(__mv, __q);
+      else if (__accept_bounds)
+        __vm_is_trailing_zeros = __ryu::__multiple_of_power_of_5(__mm, __q);
+      else
+        __vp -= __ryu::__multiple_of_power_of_5(__mp, __q);
+    }
+  } else {
+    const uint32_t __q = __ryu::__log10_pow5(-__e2);
+    __e10              = static_cast<int32_t>(__q) + __e2;
+    const int32_t __i  = -__e2 - static_cast<int32_t>(__q);
+    const int32_t __k  = __ryu::__pow5bits(__i) - __itoa::__ryu_float_pow5_bitcount;
+    int32_t __j        = static_cast<int32_t>(__q) - __k;
+    __vr               = __ryu::__mul_shift_32(__mv, __itoa::__ryu_float_pow5_split[__i], __j);
+    __vp               = __ryu::__mul_shift_32(__mp, __itoa::__ryu_float_pow5_split[__i], __j);
+    __vm               = __ryu::__mul_shift_32(__mm, __itoa::__ryu_float_pow5_split[__i], __j);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10) {
+      __j = static_cast<int32_t>(__q) - 1 - (__ryu::__pow5bits(__i + 1) - __itoa::__ryu_float_pow5_bitcount);
+      __last_removed_digit =
+          static_cast<uint8_t>(__ryu::__mul_shift_32(__mv, __itoa::__ryu_float_pow5_split[__i + 1], __j) % 10);
+    }
+    if (__q <= 1) {
+      // mv = 4 * m2, so it always has at least two trailing 0 bits.
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+        // mm = mv - 1 - mm_shift, so it has 1 trailing 0 bit iff mm_shift == 1.
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      else
+        // mp = mv + 2, so it always has at least one trailing 0 bit.
+        --__vp;
+    } else if (__q < 31) {
+      __vr_is_trailing_zeros = __ryu::__multiple_of_power_of_2(__mv, __q - 1);
+    }
+  }
+
+  // Step 4: Find the shortest decimal representation in the interval of valid representations.
+  int32_t __removed = 0;
+  uint32_t __output;
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros) {
+    // General case, which happens rarely (~4.0%).
+    for (; __vp / 10 > __vm / 10; ++__removed) {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+    if (__vm_is_trailing_zeros) {
+      for (; __vm % 10 == 0; ++__removed) {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+      // Round even if the exact number is .....50..0.
+      __last_removed_digit = 4;
+    // We need to take vr + 1 if vr is outside bounds or we need to round up.
+    __output = __vr + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  } else {
+    // Specialized for the common case (~96.0%).
+    for (; __vp / 10 > __vm / 10; ++__removed) {
+      __last_removed_digit = static_cast<uint8_t>(__vr % 10);
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+    }
+    // We need to take vr + 1 if vr is outside bounds or we need to round up.
+    __output = __vr + (__vr == __vm || __last_removed_digit >= 5);
+  }
+
+  return {__output, __e10 + __removed};
+}
+
+} // namespace __ryu
+
+#endif // _LIBCPP_STD_VER >= 17
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___CHARCONV_RYU_H
@@ -0,0 +1,99 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___CHARCONV_SWAR_H
+#define _LIBCPP___CHARCONV_SWAR_H
+
+#include <__config>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 17
+
+namespace __itoa {
+
+// SIMD within a register helpers to convert runs of decimal digits.
+//
+// The algorithms are based on
+// https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/
+// A chunk of eight characters is loaded in a 64-bit integer with the first
+// character in the least significant byte, validated with a few bitwise
+// operations, and then reduced to its value using three multiplications.
+
+// Loads eight characters with the first character in the least significant
+// byte, independent of the platform's endianness. Compilers fold the loop in a
+// single (possibly byte swapped) unaligned load, and unlike memcpy it is usable
+// during constant evaluation.
+_LIBCPP_HIDE_FROM_ABI inline _LIBCPP_CONSTEXPR_SINCE_CXX23 uint64_t __swar_load8(const char* __p) {
+  uint64_t __r = 0;
+  for (int __i = 0; __i != 8; ++__i)
+    __r |= static_cast<uint64_t>(static_cast<unsigned char>(__p[__i])) << (8 * __i);
+  return __r;
+}
+
+// Returns whether all eight bytes of __v are in the range ['0', '9'].
+_LIBCPP_HIDE_FROM_ABI inline _LIBCPP_CONSTEXPR_SINCE_CXX23 bool __swar_is_eight_digits(uint64_t __v) {
+  return ((__v & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+          (((__v + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) ==
+         UINT64_C(0x3333333333333333);
+}
+
+// Returns the value of the eight digits in __v.
+//
+// precondition: __swar_is_eight_digits(__v)
+_LIBCPP_HIDE_FROM_ABI inline _LIBCPP_CONSTEXPR_SINCE_CXX23 uint32_t __swar_parse_eight_digits(uint64_t __v) {
+  const uint64_t __mask = UINT64_C(0x000000FF000000FF);
+  const uint64_t __mul1 = UINT64_C(0x000F424000000064); // 100 + (1000000 << 32)
+  const uint64_t __mul2 = UINT64_C(0x0000271000000001); // 1 + (10000 << 32)
+  __v -= UINT64_C(0x3030303030303030);
+  __v = (__v * 10) + (__v >> 8); // Combines adjacent digits into 2-digit values.
+  __v = (((__v & __mask) * __mul1) + (((__v >> 16) & __mask) * __mul2)) >> 32;
+  return static_cast<uint32_t>(__v);
+}
+
+// Parses the first eight characters of [__p, __ep) when they are all digits.
+// Returns false, leaving __value untouched, otherwise.
+_LIBCPP_HIDE_FROM_ABI inline _LIBCPP_CONSTEXPR_SINCE_CXX23 bool
+__swar_try_parse_eight_digits(const char* __p, const char* __ep, uint32_t& __value) {
+  if (__ep - __p < 8)
+    return false;
+  uint64_t __v = __itoa::__swar_load8(__p);
+  if (!__itoa::__swar_is_eight_digits(__v))
+    return false;
+  __value = __itoa::__swar_parse_eight_digits(__v);
+  return true;
+}
+
+// Parses sixteen digits as two independent eight digit chunks, which allows
+// the processor to overlap both dependency chains.
+_LIBCPP_HIDE_FROM_ABI inline _LIBCPP_CONSTEXPR_SINCE_CXX23 bool
+__swar_try_parse_sixteen_digits(const char* __p, const char* __ep, uint64_t& __value) {
+  if (__ep - __p < 16)
+    return false;
+  uint64_t __hi = __itoa::__swar_load8(__p);
+  uint64_t __lo = __itoa::__swar_load8(__p + 8);
+  if (!__itoa::__swar_is_eight_digits(__hi) || !__itoa::__swar_is_eight_digits(__lo))
+    return false;
+  __value = static_cast<uint64_t>(__itoa::__swar_parse_eight_digits(__hi)) * UINT64_C(100000000) +
+            __itoa::__swar_parse_eight_digits(__lo);
+  return true;
+}
+
+} // namespace __itoa
+
+#endif // _LIBCPP_STD_VER >= 17
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___CHARCONV_SWAR_H
@@ -10,46 +10,369 @@
 #ifndef _LIBCPP___CHARCONV_TO_CHARS_FLOATING_POINT_H
 #define _LIBCPP___CHARCONV_TO_CHARS_FLOATING_POINT_H
 
+#include <__bit/bit_cast.h>
+#include <__bit/countr.h>
 #include <__charconv/chars_format.h>
+#include <__charconv/ryu.h>
+#include <__charconv/tables.h>
 #include <__charconv/to_chars_result.h>
 #include <__config>
+#include <__system_error/errc.h>
+#include <cstdint>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
 #endif
 
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 #if _LIBCPP_STD_VER >= 17
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, float __value);
+to_chars(char* __first, char* __last, long double __value);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, double __value);
+to_chars(char* __first, char* __last, long double __value, chars_format __fmt);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, long double __value);
+to_chars(char* __first, char* __last, float __value, chars_format __fmt, int __precision);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, float __value, chars_format __fmt);
+to_chars(char* __first, char* __last, double __value, chars_format __fmt, int __precision);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, double __value, chars_format __fmt);
+to_chars(char* __first, char* __last, long double __value, chars_format __fmt, int __precision);
+
+// The shortest round-trip overloads for float and double are implemented in
+// the headers, which lets the compiler inline the conversion in hot loops and
+// in std::format. The dylib keeps exporting the out-of-line definitions, which
+// are used by code compiled against older headers.
+#  ifdef _LIBCPP_BUILDING_LIBRARY
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, long double __value, chars_format __fmt);
+to_chars(char* __first, char* __last, float __value);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, float __value, chars_format __fmt, int __precision);
+to_chars(char* __first, char* __last, double __value);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, double __value, chars_format __fmt, int __precision);
+to_chars(char* __first, char* __last, float __value, chars_format __fmt);
 
 _LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT _LIBCPP_EXPORTED_FROM_ABI to_chars_result
-to_chars(char* __first, char* __last, long double __value, chars_format __fmt, int __precision);
-#endif // _LIBCPP_STD_VER >= 17
+to_chars(char* __first, char* __last, double __value, chars_format __fmt);
+
+#  else // _LIBCPP_BUILDING_LIBRARY
+
+template <class _Fp>
+struct __to_chars_shortest_traits;
+
+template <>
+struct __to_chars_shortest_traits<float> {
+  using __uint_type                         = uint32_t;
+  static constexpr int __mantissa_bits      = 23;
+  static constexpr int __exponent_bits      = 8;
+  static constexpr int __bias               = 127;
+  static constexpr int __hex_digits         = 6; // The mantissa is shifted left by one bit.
+  static constexpr int __max_fixed_exponent = 10;
+
+  // The largest odd value whose product with 5^__e is still exactly
+  // representable, see __to_chars_shortest_fixed.
+  _LIBCPP_HIDE_FROM_ABI static uint32_t __max_shifted_mantissa(int32_t __e) {
+    uint32_t __pow5 = 1;
+    for (; __e != 0; --__e)
+      __pow5 *= 5;
+    return ((UINT32_C(1) << 24) - 1) / __pow5;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static __ryu::__floating_decimal_32 __to_decimal(uint32_t __mantissa, uint32_t __exponent) {
+    return __ryu::__f2d(__mantissa, __exponent);
+  }
+};
+
+template <>
+struct __to_chars_shortest_traits<double> {
+  using __uint_type                         = uint64_t;
+  static constexpr int __mantissa_bits      = 52;
+  static constexpr int __exponent_bits      = 11;
+  static constexpr int __bias               = 1023;
+  static constexpr int __hex_digits         = 13;
+  static constexpr int __max_fixed_exponent = 22;
+
+  _LIBCPP_HIDE_FROM_ABI static uint64_t __max_shifted_mantissa(int32_t __e) {
+    uint64_t __pow5 = 1;
+    for (; __e != 0; --__e)
+      __pow5 *= 5;
+    return ((UINT64_C(1) << 53) - 1) / __pow5;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static __ryu::__floating_decimal_64 __to_decimal(uint64_t __mantissa, uint32_t __exponent) {
+    return __ryu::__d2d(__mantissa, __exponent);
+  }
+};
+
+// Writes the decimal digits of __value so that the last digit is at __last[-1].
+template <class _Up>
+_LIBCPP_HIDE_FROM_ABI void __to_chars_shortest_digits(char* __last, _Up __value) {
+  while (__value >= 100) {
+    const unsigned __r = static_cast<unsigned>(__value % 100);
+    __value /= 100;
+    __last -= 2;
+    __last[0] = __itoa::__digits_base_10[2 * __r];
+    __last[1] = __itoa::__digits_base_10[2 * __r + 1];
+  }
+  if (__value >= 10) {
+    const unsigned __r = static_cast<unsigned>(__value);
+    __last[-2]         = __itoa::__digits_base_10[2 * __r];
+    __last[-1]         = __itoa::__digits_base_10[2 * __r + 1];
+  } else
+    __last[-1] = static_cast<char>('0' + __value);
+}
+
+template <class _Up>
+_LIBCPP_HIDE_FROM_ABI int32_t __to_chars_shortest_width(_Up __value) {
+  int32_t __n = 1;
+  for (; __value >= 10000; __value /= 10000)
+    __n += 4;
+  for (; __value >= 10; __value /= 10)
+    ++__n;
+  return __n;
+}
+
+// Writes __mantissa * 10^__exponent in the form d.ddde+XX.
+template <class _Up>
+_LIBCPP_HIDE_FROM_ABI to_chars_result
+__to_chars_shortest_scientific(char* __first, char* __last, _Up __mantissa, int32_t __olength, int32_t __exponent) {
+  int32_t __sci_exponent = __exponent + __olength - 1;
+  const int32_t __size   = __olength + (__olength > 1) + (__sci_exponent <= -100 || __sci_exponent >= 100 ? 5 : 4);
+  if (__last - __first < __size)
+    return {__last, errc::value_too_large};
+
+  // Write the digits one position to the right and move the leading digit in
+  // front of the decimal point.
+  std::__to_chars_shortest_digits(__first + __olength + 1, __mantissa);
+  __first[0] = __first[1];
+  if (__olength > 1)
+    __first[1] = '.';
+  __first += __olength + (__olength > 1);
+
+  *__first++ = 'e';
+  if (__sci_exponent < 0) {
+    *__first++     = '-';
+    __sci_exponent = -__sci_exponent;
+  } else
+    *__first++ = '+';
+  if (__sci_exponent >= 100) {
+    *__first++ = static_cast<char>('0' + __sci_exponent / 100);
+    __sci_exponent %= 100;
+  }
+  *__first++ = __itoa::__digits_base_10[2 * __sci_exponent];
+  *__first++ = __itoa::__digits_base_10[2 * __sci_exponent + 1];
+  return {__first, errc{}};
+}
+
+// Writes __mantissa * 10^__exponent without an exponent.
+//
+// When __exponent > 0 the shortest representation, padded with zeros, is not
+// necessarily the exact value of the integer __value. For example 1e23 is
+// 99999999999999991611392. Since 10^__exponent is 5^__exponent * 2^__exponent
+// the padded representation is exact when the odd part of __mantissa times
+// 5^__exponent fits in the mantissa. Otherwise the exact digits are produced by
+// the precision overload.
+template <class _Fp, class _Up>
+_LIBCPP_HIDE_FROM_ABI to_chars_result __to_chars_shortest_fixed(
+    char* __first, char* __last, _Fp __value, _Up __mantissa, int32_t __olength, int32_t __exponent) {
+  using __traits = __to_chars_shortest_traits<_Fp>;
+  if (__exponent > 0) {
+    if (__exponent > __traits::__max_fixed_exponent ||
+        (__mantissa >> std::__countr_zero(__mantissa)) > __traits::__max_shifted_mantissa(__exponent))
+      return std::to_chars(__first, __last, __value, chars_format::fixed, 0);
+  }
+
+  const int32_t __whole_digits = __olength + __exponent;
+  if (__exponent >= 0) {
+    // 1729, 17290
+    if (__last - __first < __whole_digits)
+      return {__last, errc::value_too_large};
+    std::__to_chars_shortest_digits(__first + __olength, __mantissa);
+    for (char* __p = __first + __olength; __p != __first + __whole_digits; ++__p)
+      *__p = '0';
+    return {__first + __whole_digits, errc{}};
+  }
+
+  if (__whole_digits > 0) {
+    // 17.29
+    if (__last - __first < __olength + 1)
+      return {__last, errc::value_too_large};
+    std::__to_chars_shortest_digits(__first + __olength + 1, __mantissa);
+    for (int32_t __i = 0; __i != __whole_digits; ++__i)
+      __first[__i] = __first[__i + 1];
+    __first[__whole_digits] = '.';
+    return {__first + __olength + 1, errc{}};
+  }
+
+  // 0.001729
+  const int32_t __size = 2 - __whole_digits + __olength;
+  if (__last - __first < __size)
+    return {__last, errc::value_too_large};
+  __first[0] = '0';
+  __first[1] = '.';
+  for (int32_t __i = 2; __i != 2 - __whole_digits; ++__i)
+    __first[__i] = '0';
+  std::__to_chars_shortest_digits(__first + __size, __mantissa);
+  return {__first + __size, errc{}};
+}
+
+// Writes the shortest hexadecimal representation, e.g. 1.8p+1 for 3.0.
+template <class _Fp>
+_LIBCPP_HIDE_FROM_ABI to_chars_result __to_chars_shortest_hex(
+    char* __first,
+    char* __last,
+    typename __to_chars_shortest_traits<_Fp>::__uint_type __ieee_mantissa,
+    int32_t __ieee_exponent) {
+  using __traits = __to_chars_shortest_traits<_Fp>;
+  using _Up      = typename __traits::__uint_type;
+
+  int32_t __exponent;
+  char __leading;
+  if (__ieee_exponent == 0) {
+    __leading  = '0';
+    __exponent = __ieee_mantissa == 0 ? 0 : 1 - __traits::__bias;
+  } else {
+    __leading  = '1';
+    __exponent = __ieee_exponent - __traits::__bias;
+  }
+
+  // Align the mantissa to a whole number of hexits and drop the trailing zero hexits.
+  _Up __mantissa   = __ieee_mantissa << (4 * __traits::__hex_digits - __traits::__mantissa_bits);
+  int32_t __hexits  = 0;
+  if (__mantissa != 0) {
+    __hexits = __traits::__hex_digits - std::__countr_zero(__mantissa) / 4;
+    __mantissa >>= 4 * (__traits::__hex_digits - __hexits);
+  }
+
+  const unsigned __abs_exponent   = static_cast<unsigned>(__exponent < 0 ? -__exponent : __exponent);
+  const int32_t __exponent_digits =
+      __abs_exponent >= 1000 ? 4 : __abs_exponent >= 100 ? 3 : __abs_exponent >= 10 ? 2 : 1;
+  const int32_t __size            = 1 + (__hexits != 0) + __hexits + 2 + __exponent_digits;
+  if (__last - __first < __size)
+    return {__last, errc::value_too_large};
+
+  *__first++ = __leading;
+  if (__hexits != 0) {
+    *__first++ = '.';
+    for (int32_t __i = __hexits; __i != 0; --__i, __mantissa >>= 4)
+      __first[__i - 1] = "0123456789abcdef"[__mantissa & 0xF];
+    __first += __hexits;
+  }
+  *__first++ = 'p';
+  *__first++ = __exponent < 0 ? '-' : '+';
+  std::__to_chars_shortest_digits(__first + __exponent_digits, __abs_exponent);
+  return {__first + __exponent_digits, errc{}};
+}
+
+// Implements the shortest round-trip overloads. __fmt == chars_format{}
+// selects the plain overload, which uses the shorter of the fixed and
+// scientific notations, preferring fixed on a tie.
+template <class _Fp>
+_LIBCPP_HIDE_FROM_ABI to_chars_result
+__to_chars_shortest(char* __first, char* __last, _Fp __value, chars_format __fmt) {
+  using __traits = __to_chars_shortest_traits<_Fp>;
+  using _Up      = typename __traits::__uint_type;
+
+  _Up __bits                    = std::__bit_cast<_Up>(__value);
+  const _Up __sign_mask         = _Up(1) << (__traits::__mantissa_bits + __traits::__exponent_bits);
+  const _Up __mantissa_mask     = (_Up(1) << __traits::__mantissa_bits) - 1;
+  const uint32_t __exponent_max = (uint32_t(1) << __traits::__exponent_bits) - 1;
+
+  if (static_cast<uint32_t>((__bits & ~__sign_mask) >> __traits::__mantissa_bits) == __exponent_max)
+    // The infinity and NaN spellings, including their sign, don't depend on the format and precision.
+    return std::to_chars(__first, __last, __value, chars_format::general, 0);
+
+  if (__bits & __sign_mask) {
+    if (__first == __last)
+      return {__last, errc::value_too_large};
+    *__first++ = '-';
+    __bits &= ~__sign_mask;
+    __value = std::__bit_cast<_Fp>(__bits);
+  }
+
+  const _Up __ieee_mantissa      = __bits & __mantissa_mask;
+  const uint32_t __ieee_exponent = static_cast<uint32_t>(__bits >> __traits::__mantissa_bits);
+
+  if (__fmt == chars_format::hex)
+    return std::__to_chars_shortest_hex<_Fp>(__first, __last, __ieee_mantissa, __ieee_exponent);
+
+  if (__bits == 0) {
+    if (__fmt == chars_format::scientific) {
+      if (__last - __first < 5)
+        return {__last, errc::value_too_large};
+      __first[0] = '0';
+      __first[1] = 'e';
+      __first[2] = '+';
+      __first[3] = '0';
+      __first[4] = '0';
+      return {__first + 5, errc{}};
+    }
+    if (__first == __last)
+      return {__last, errc::value_too_large};
+    *__first = '0';
+    return {__first + 1, errc{}};
+  }
+
+  const auto __decimal     = __traits::__to_decimal(__ieee_mantissa, __ieee_exponent);
+  const int32_t __olength  = std::__to_chars_shortest_width(__decimal.__mantissa);
+  const int32_t __exponent = __decimal.__exponent;
+
+  bool __use_fixed;
+  if (__fmt == chars_format{}) {
+    // Compare the lengths of both notations. For example, 1e+10 is shorter
+    // than 10000000000, while 1729e+10 isn't shorter than 17290000000000.
+    // The thresholds are derived from the lengths of the exponent part.
+    if (__olength == 1)
+      __use_fixed = __exponent >= -3 && __exponent <= 4;
+    else
+      __use_fixed = __exponent >= -(__olength + 3) && __exponent <= 5;
+  } else if (__fmt == chars_format::general) {
+    // Use the rules of printf's %g with the default precision P = 6; fixed is
+    // used when P > X >= -4, with X the scientific exponent.
+    const int32_t __sci_exponent = __exponent + __olength - 1;
+    __use_fixed                  = __sci_exponent >= -4 && __sci_exponent < 6;
+  } else
+    __use_fixed = __fmt == chars_format::fixed;
+
+  if (__use_fixed)
+    return std::__to_chars_shortest_fixed(__first, __last, __value, __decimal.__mantissa, __olength, __exponent);
+  return std::__to_chars_shortest_scientific(__first, __last, __decimal.__mantissa, __olength, __exponent);
+}
+
+_LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT inline _LIBCPP_HIDE_FROM_ABI to_chars_result
+to_chars(char* __first, char* __last, float __value) {
+  return std::__to_chars_shortest(__first, __last, __value, chars_format{});
+}
+
+_LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT inline _LIBCPP_HIDE_FROM_ABI to_chars_result
+to_chars(char* __first, char* __last, double __value) {
+  return std::__to_chars_shortest(__first, __last, __value, chars_format{});
+}
+
+_LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT inline _LIBCPP_HIDE_FROM_ABI to_chars_result
+to_chars(char* __first, char* __last, float __value, chars_format __fmt) {
+  return std::__to_chars_shortest(__first, __last, __value, __fmt);
+}
+
+_LIBCPP_AVAILABILITY_TO_CHARS_FLOATING_POINT inline _LIBCPP_HIDE_FROM_ABI to_chars_result
+to_chars(char* __first, char* __last, double __value, chars_format __fmt) {
+  return std::__to_chars_shortest(__first, __last, __value, __fmt);
+}
+
+#  endif // _LIBCPP_BUILDING_LIBRARY
+#endif   // _LIBCPP_STD_VER >= 17
 
 _LIBCPP_END_NAMESPACE_STD
 
+_LIBCPP_POP_MACROS
+
 #endif // _LIBCPP___CHARCONV_TO_CHARS_FLOATING_POINT_H
@@ -0,0 +1,644 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+// For information see https://libcxx.llvm.org/DesignDocs/TimeZone.html
+
+#ifndef _LIBCPP___CHRONO_TZIF_ZONE_H
+#define _LIBCPP___CHRONO_TZIF_ZONE_H
+
+#include <version>
+// Enable the contents of the header only when libc++ was built with experimental features enabled.
+#if _LIBCPP_HAS_EXPERIMENTAL_TZDB
+
+#  include <__algorithm/upper_bound.h>
+#  include <__chrono/calendar.h>
+#  include <__chrono/duration.h>
+#  include <__chrono/exception.h>
+#  include <__chrono/local_info.h>
+#  include <__chrono/month.h>
+#  include <__chrono/sys_info.h>
+#  include <__chrono/system_clock.h>
+#  include <__chrono/time_zone.h>
+#  include <__chrono/weekday.h>
+#  include <__chrono/year.h>
+#  include <__chrono/year_month_day.h>
+#  include <__chrono/year_month_weekday.h>
+#  include <__chrono/zoned_time.h>
+#  include <__config>
+#  include <__memory/unique_ptr.h>
+#  include <__type_traits/common_type.h>
+#  include <__utility/move.h>
+#  include <__utility/swap.h>
+#  include <__vector/vector.h>
+#  include <cstdint>
+#  include <cstdio>
+#  include <cstdlib>
+#  include <map>
+#  include <stdexcept>
+#  include <string>
+#  include <string_view>
+
+#  if _LIBCPP_HAS_THREADS
+#    include <__mutex/lock_guard.h>
+#    include <__mutex/mutex.h>
+#  endif
+
+#  if __has_include(<unistd.h>)
+#    include <unistd.h>
+#  endif
+
+#  if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#    pragma GCC system_header
+#  endif
+
+_LIBCPP_PUSH_MACROS
+#  include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#  if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_TIME_ZONE_DATABASE && _LIBCPP_HAS_FILESYSTEM && _LIBCPP_HAS_LOCALIZATION
+
+namespace chrono {
+
+class tzif_database;
+
+// A time zone read from its compiled TZif file (RFC 8536).
+//
+// get_tzdb() parses the text sources of the whole database on first use. A
+// tzif_zone only reads the binary file of a single zone, and keeps its
+// transitions in a sorted table, so that get_info, to_sys and to_local are a
+// binary search. Past the last transition in the file the zone follows the
+// POSIX TZ rule stored in the footer of the file.
+//
+// The zone has the interface zoned_time expects of a time zone pointer, and
+// zoned_time<_Duration, const tzif_zone*> uses it with the zoned_traits below.
+class tzif_zone {
+  friend class tzif_database;
+
+  struct __type {
+    seconds __offset;
+    bool __is_dst;
+    unsigned char __abbrev; // index into __abbrevs_
+  };
+
+  // A date of the POSIX TZ rule: Jn, n or Mm.w.d, and the local time of day.
+  struct __rule_date {
+    char __kind; // 'J', 'n' or 'M'
+    int __month;
+    int __week;
+    int __day;
+    seconds __time;
+  };
+
+  struct __rule {
+    string __std_abbrev;
+    string __dst_abbrev;
+    seconds __std_offset;
+    seconds __dst_offset;
+    bool __has_dst;
+    __rule_date __start;
+    __rule_date __end;
+  };
+
+public:
+  tzif_zone(const tzif_zone&)            = delete;
+  tzif_zone& operator=(const tzif_zone&) = delete;
+
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI string_view name() const noexcept { return __name_; }
+
+  template <class _Duration>
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI sys_info get_info(const sys_time<_Duration>& __time) const {
+    return __get_info(chrono::time_point_cast<seconds>(__time));
+  }
+
+  template <class _Duration>
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI local_info get_info(const local_time<_Duration>& __time) const {
+    return __get_info(chrono::time_point_cast<seconds>(__time));
+  }
+
+  template <class _Duration>
+  _LIBCPP_HIDE_FROM_ABI sys_time<common_type_t<_Duration, seconds>> to_sys(const local_time<_Duration>& __time) const {
+    local_info __info = get_info(__time);
+    if (__info.result == local_info::nonexistent)
+      chrono::__throw_nonexistent_local_time(__time, __info);
+    if (__info.result == local_info::ambiguous)
+      chrono::__throw_ambiguous_local_time(__time, __info);
+    return sys_time<common_type_t<_Duration, seconds>>{__time.time_since_epoch() - __info.first.offset};
+  }
+
+  template <class _Duration>
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI sys_time<common_type_t<_Duration, seconds>>
+  to_sys(const local_time<_Duration>& __time, choose __z) const {
+    local_info __info = get_info(__time);
+    if (__info.result == local_info::nonexistent)
+      return sys_time<common_type_t<_Duration, seconds>>{__info.first.end};
+    if (__info.result == local_info::ambiguous && __z == choose::latest)
+      return sys_time<common_type_t<_Duration, seconds>>{__time.time_since_epoch() - __info.second.offset};
+    return sys_time<common_type_t<_Duration, seconds>>{__time.time_since_epoch() - __info.first.offset};
+  }
+
+  template <class _Duration>
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI local_time<common_type_t<_Duration, seconds>>
+  to_local(const sys_time<_Duration>& __time) const {
+    return local_time<common_type_t<_Duration, seconds>>{__time.time_since_epoch() + get_info(__time).offset};
+  }
+
+private:
+  _LIBCPP_HIDE_FROM_ABI explicit tzif_zone(string __name) : __name_(std::move(__name)), __has_rule_(false) {}
+
+  string __name_;
+  vector<sys_seconds> __at_;        // the transitions, sorted
+  vector<unsigned char> __at_type_; // the type that starts at each transition
+  vector<__type> __types_;          // __types_[0] applies before the first transition
+  string __abbrevs_;
+  __rule __rule_;
+  bool __has_rule_;
+
+  // Parsing
+
+  _LIBCPP_HIDE_FROM_ABI static int64_t __read_be(const unsigned char* __p, size_t __n) {
+    uint64_t __v = 0;
+    for (size_t __i = 0; __i != __n; ++__i)
+      __v = (__v << 8) | __p[__i];
+    // Sign extend the 32-bit values.
+    if (__n == 4)
+      return static_cast<int32_t>(static_cast<uint32_t>(__v));
+    return static_cast<int64_t>(__v);
+  }
+
+  // Returns false if __data does not hold a valid TZif file.
+  _LIBCPP_HIDE_FROM_ABI bool __parse(const unsigned char* __data, size_t __size) {
+    const unsigned char* __p   = __data;
+    const unsigned char* __end = __data + __size;
+    if (__size < 44 || __p[0] != 'T' || __p[1] != 'Z' || __p[2] != 'i' || __p[3] != 'f')
+      return false;
+    bool __v2 = __p[4] >= '2';
+    for (int __pass = 0; __pass != (__v2 ? 2 : 1); ++__pass) {
+      if (__end - __p < 44)
+        return false;
+      size_t __isutcnt  = static_cast<uint32_t>(__read_be(__p + 20, 4));
+      size_t __isstdcnt = static_cast<uint32_t>(__read_be(__p + 24, 4));
+      size_t __leapcnt  = static_cast<uint32_t>(__read_be(__p + 28, 4));
+      size_t __timecnt  = static_cast<uint32_t>(__read_be(__p + 32, 4));
+      size_t __typecnt  = static_cast<uint32_t>(__read_be(__p + 36, 4));
+      size_t __charcnt  = static_cast<uint32_t>(__read_be(__p + 40, 4));
+      // Version 1 data uses 32-bit times, the data that follows it 64-bit ones.
+      size_t __time_size = __pass == 1 ? 8 : 4;
+      size_t __block     = __timecnt * (__time_size + 1) + __typecnt * 6 + __charcnt +
+                       __leapcnt * (__time_size + 4) + __isstdcnt + __isutcnt;
+      __p += 44;
+      if (static_cast<size_t>(__end - __p) < __block || __typecnt == 0 || __typecnt > 256 || __charcnt == 0)
+        return false;
+      if (__v2 && __pass == 0) {
+        // Skip the version 1 data; the 64-bit data that follows is complete.
+        __p += __block;
+        continue;
+      }
+
+      const unsigned char* __times   = __p;
+      const unsigned char* __indices = __times + __timecnt * __time_size;
+      const unsigned char* __types   = __indices + __timecnt;
+      const unsigned char* __chars   = __types + __typecnt * 6;
+      __types_.reserve(__typecnt);
+      for (size_t __i = 0; __i != __typecnt; ++__i) {
+        const unsigned char* __t = __types + __i * 6;
+        if (__t[5] >= __charcnt)
+          return false;
+        __types_.push_back(__type{seconds(__read_be(__t, 4)), __t[4] != 0, __t[5]});
+      }
+      __abbrevs_.assign(reinterpret_cast<const char*>(__chars), __charcnt);
+      // Drop the transitions that do not change anything, so that every
+      // entry of the table starts a new period.
+      __at_.reserve(__timecnt);
+      __at_type_.reserve(__timecnt);
+      for (size_t __i = 0; __i != __timecnt; ++__i) {
+        unsigned char __index = __indices[__i];
+        if (__index >= __typecnt)
+          return false;
+        sys_seconds __at{seconds(__read_be(__times + __i * __time_size, __time_size))};
+        if (!__at_.empty() && __at <= __at_.back())
+          return false;
+        if (__same_type(__at_type_.empty() ? 0 : __at_type_.back(), __index))
+          continue;
+        __at_.push_back(__at);
+        __at_type_.push_back(__index);
+      }
+      __p += __block;
+    }
+
+    // The footer, "\n<POSIX TZ string>\n", describes the times after the last
+    // transition.
+    if (__v2 && __p != __end && *__p == '\n') {
+      const unsigned char* __nl = __p + 1;
+      while (__nl != __end && *__nl != '\n')
+        ++__nl;
+      if (__nl != __end)
+        __has_rule_ =
+            __parse_rule(string_view(reinterpret_cast<const char*>(__p + 1), static_cast<size_t>(__nl - __p - 1)));
+    }
+    return true;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool __same_type(unsigned char __x, unsigned char __y) const {
+    const __type& __a = __types_[__x];
+    const __type& __b = __types_[__y];
+    return __a.__offset == __b.__offset && __a.__is_dst == __b.__is_dst &&
+           __abbrev(__a.__abbrev) == __abbrev(__b.__abbrev);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static bool __parse_abbrev(string_view __s, size_t& __i, string& __out) {
+    size_t __first = __i;
+    if (__i != __s.size() && __s[__i] == '<') {
+      while (__i != __s.size() && __s[__i] != '>')
+        ++__i;
+      if (__i == __s.size())
+        return false;
+      __out.assign(__s.substr(__first + 1, __i - __first - 1));
+      ++__i;
+    } else {
+      while (__i != __s.size() && ((__s[__i] >= 'A' && __s[__i] <= 'Z') || (__s[__i] >= 'a' && __s[__i] <= 'z')))
+        ++__i;
+      __out.assign(__s.substr(__first, __i - __first));
+    }
+    return __out.size() >= 3;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static bool __parse_number(string_view __s, size_t& __i, int __max, int& __out) {
+    if (__i == __s.size() || __s[__i] < '0' || __s[__i] > '9')
+      return false;
+    __out = 0;
+    while (__i != __s.size() && __s[__i] >= '0' && __s[__i] <= '9') {
+      __out = __out * 10 + (__s[__i++] - '0');
+      if (__out > __max)
+        return false;
+    }
+    return true;
+  }
+
+  // [+|-]hh[:mm[:ss]]
+  _LIBCPP_HIDE_FROM_ABI static bool __parse_time(string_view __s, size_t& __i, seconds& __out) {
+    bool __negative = false;
+    if (__i != __s.size() && (__s[__i] == '+' || __s[__i] == '-'))
+      __negative = __s[__i++] == '-';
+    int __h = 0, __m = 0, __sec = 0;
+    if (!__parse_number(__s, __i, 167, __h))
+      return false;
+    if (__i != __s.size() && __s[__i] == ':' && !__parse_number(__s, ++__i, 59, __m))
+      return false;
+    if (__i != __s.size() && __s[__i] == ':' && !__parse_number(__s, ++__i, 59, __sec))
+      return false;
+    __out = seconds(__h * 3600 + __m * 60 + __sec);
+    if (__negative)
+      __out = -__out;
+    return true;
+  }
+
+  // Jn, n or Mm.w.d, followed by an optional /time.
+  _LIBCPP_HIDE_FROM_ABI static bool __parse_date(string_view __s, size_t& __i, __rule_date& __out) {
+    __out = __rule_date{'n', 0, 0, 0, hours(2)};
+    if (__i != __s.size() && __s[__i] == 'M') {
+      __out.__kind = 'M';
+      if (!__parse_number(__s, ++__i, 12, __out.__month) || __out.__month == 0 || __i == __s.size() ||
+          __s[__i] != '.' || !__parse_number(__s, ++__i, 5, __out.__week) || __out.__week == 0 ||
+          __i == __s.size() || __s[__i] != '.' || !__parse_number(__s, ++__i, 6, __out.__day))
+        return false;
+    } else {
+      if (__i != __s.size() && __s[__i] == 'J') {
+        __out.__kind = 'J';
+        ++__i;
+      }
+      if (!__parse_number(__s, __i, 365, __out.__day) || (__out.__kind == 'J' && __out.__day == 0))
+        return false;
+    }
+    if (__i != __s.size() && __s[__i] == '/')
+      return __parse_time(__s, ++__i, __out.__time);
+    return true;
+  }
+
+  // std offset [dst [offset] [,start[/time],end[/time]]]
+  _LIBCPP_HIDE_FROM_ABI bool __parse_rule(string_view __s) {
+    size_t __i = 0;
+    if (!__parse_abbrev(__s, __i, __rule_.__std_abbrev) || !__parse_time(__s, __i, __rule_.__std_offset))
+      return false;
+    // POSIX offsets are positive west of Greenwich.
+    __rule_.__std_offset = -__rule_.__std_offset;
+    __rule_.__has_dst    = __i != __s.size();
+    if (!__rule_.__has_dst)
+      return true;
+    if (!__parse_abbrev(__s, __i, __rule_.__dst_abbrev))
+      return false;
+    __rule_.__dst_offset = __rule_.__std_offset + hours(1);
+    if (__i != __s.size() && __s[__i] != ',') {
+      if (!__parse_time(__s, __i, __rule_.__dst_offset))
+        return false;
+      __rule_.__dst_offset = -__rule_.__dst_offset;
+    }
+    if (__i == __s.size()) {
+      // The rule is implementation-defined; use the one of the United States.
+      __rule_.__start = __rule_date{'M', 3, 2, 0, hours(2)};
+      __rule_.__end   = __rule_date{'M', 11, 1, 0, hours(2)};
+      return true;
+    }
+    return __s[__i] == ',' && __parse_date(__s, ++__i, __rule_.__start) && __i != __s.size() && __s[__i] == ',' &&
+           __parse_date(__s, ++__i, __rule_.__end) && __i == __s.size();
+  }
+
+  // Lookup
+
+  _LIBCPP_HIDE_FROM_ABI string __abbrev(unsigned char __index) const {
+    return string(__abbrevs_.c_str() + __index);
+  }
+
+  // The DST adjustment of the period that starts at transition __i; __i is
+  // __at_.size() for the period before the first transition. TZif only records
+  // whether a type is DST, so the save is its offset minus the one of the
+  // closest standard time period.
+  _LIBCPP_HIDE_FROM_ABI minutes __save(size_t __i) const {
+    const __type& __t = __types_[__i == __at_.size() ? 0 : __at_type_[__i]];
+    if (!__t.__is_dst)
+      return minutes(0);
+    size_t __n = __at_.size();
+    for (size_t __j = __i == __n ? 0 : __i; __j-- > 0;)
+      if (!__types_[__at_type_[__j]].__is_dst)
+        return __nonzero_save(__t.__offset - __types_[__at_type_[__j]].__offset);
+    for (size_t __j = __i == __n ? 0 : __i + 1; __j < __n; ++__j)
+      if (!__types_[__at_type_[__j]].__is_dst)
+        return __nonzero_save(__t.__offset - __types_[__at_type_[__j]].__offset);
+    return hours(1);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static minutes __nonzero_save(seconds __s) {
+    minutes __m = chrono::duration_cast<minutes>(__s);
+    return __m != minutes(0) ? __m : hours(1);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static sys_seconds __rule_at(const __rule_date& __d, int __y, seconds __offset) {
+    year __yr{__y};
+    sys_days __day;
+    if (__d.__kind == 'M') {
+      month __m{static_cast<unsigned>(__d.__month)};
+      weekday __wd{static_cast<unsigned>(__d.__day)};
+      __day = __d.__week == 5 ? sys_days(year_month_weekday_last(__yr, __m, weekday_last(__wd)))
+                              : sys_days(year_month_weekday(__yr, __m, __wd[static_cast<unsigned>(__d.__week)]));
+    } else {
+      __day = sys_days(year_month_day(__yr, January, day(1))) + days(__d.__day);
+      // Jn counts from 1 and never counts February 29.
+      if (__d.__kind == 'J')
+        __day -= days(__d.__day >= 60 && __yr.is_leap() ? 0 : 1);
+    }
+    return sys_seconds(__day) + __d.__time - __offset;
+  }
+
+  // The period of the POSIX TZ rule that contains __time, starting no earlier
+  // than __floor.
+  _LIBCPP_HIDE_FROM_ABI sys_info __rule_info(sys_seconds __time, sys_seconds __floor) const {
+    const __rule& __r = __rule_;
+    if (!__r.__has_dst)
+      return sys_info{__floor, sys_seconds::max(), __r.__std_offset, minutes(0), __r.__std_abbrev};
+
+    int __y = static_cast<int>(year_month_day(chrono::floor<days>(__time)).year());
+    if (__y < -32000)
+      __y = -32000;
+    else if (__y > 32000)
+      __y = 32000;
+
+    // The changes of the year before, the year and the year after, sorted.
+    sys_seconds __at[6];
+    bool __to_dst[6];
+    for (int __k = 0; __k != 3; ++__k) {
+      __at[2 * __k]         = __rule_at(__r.__start, __y - 1 + __k, __r.__std_offset);
+      __to_dst[2 * __k]     = true;
+      __at[2 * __k + 1]     = __rule_at(__r.__end, __y - 1 + __k, __r.__dst_offset);
+      __to_dst[2 * __k + 1] = false;
+    }
+    for (int __k = 1; __k != 6; ++__k)
+      for (int __j = __k; __j != 0 && __at[__j] < __at[__j - 1]; --__j) {
+        std::swap(__at[__j], __at[__j - 1]);
+        std::swap(__to_dst[__j], __to_dst[__j - 1]);
+      }
+
+    int __k = 0;
+    while (__k != 6 && __at[__k] <= __time)
+      ++__k;
+    bool __dst        = __k != 0 ? __to_dst[__k - 1] : !__to_dst[0];
+    sys_seconds __beg = __k != 0 && __at[__k - 1] > __floor ? __at[__k - 1] : __floor;
+    sys_seconds __end = __k != 6 ? __at[__k] : sys_seconds::max();
+    if (__dst)
+      return sys_info{__beg,
+                      __end,
+                      __r.__dst_offset,
+                      chrono::duration_cast<minutes>(__r.__dst_offset - __r.__std_offset),
+                      __r.__dst_abbrev};
+    return sys_info{__beg, __end, __r.__std_offset, minutes(0), __r.__std_abbrev};
+  }
+
+  _LIBCPP_HIDE_FROM_ABI sys_info __get_info(sys_seconds __time) const {
+    size_t __n = __at_.size();
+    size_t __i = static_cast<size_t>(std::upper_bound(__at_.begin(), __at_.end(), __time) - __at_.begin());
+    if (__i == 0) {
+      if (__n == 0 && __has_rule_)
+        return __rule_info(__time, sys_seconds::min());
+      const __type& __t = __types_[0];
+      return sys_info{sys_seconds::min(),
+                      __n != 0 ? __at_[0] : sys_seconds::max(),
+                      __t.__offset,
+                      __save(__n),
+                      __abbrev(__t.__abbrev)};
+    }
+    --__i;
+    if (__i + 1 == __n && __has_rule_)
+      return __rule_info(__time, __at_[__i]);
+    const __type& __t = __types_[__at_type_[__i]];
+    return sys_info{__at_[__i],
+                    __i + 1 != __n ? __at_[__i + 1] : sys_seconds::max(),
+                    __t.__offset,
+                    __save(__i),
+                    __abbrev(__t.__abbrev)};
+  }
+
+  // The periods whose local time range may contain __time are the one that
+  // contains the same value as a system time, and its two neighbours, since
+  // offsets are smaller than a day and periods longer than two.
+  _LIBCPP_HIDE_FROM_ABI local_info __get_info(local_seconds __time) const {
+    sys_seconds __as_sys{__time.time_since_epoch()};
+    sys_info __periods[3];
+    int __count    = 0;
+    sys_info __mid = __get_info(__as_sys);
+    if (__mid.begin != sys_seconds::min())
+      __periods[__count++] = __get_info(__mid.begin - seconds(1));
+    if (__mid.end != sys_seconds::max())
+      __periods[__count + 1] = __get_info(__mid.end);
+    __periods[__count] = std::move(__mid);
+    __count += __periods[__count].end != sys_seconds::max() ? 2 : 1;
+
+    local_info __result{local_info::nonexistent, {}, {}};
+    int __found = 0;
+    for (int __k = 0; __k != __count; ++__k) {
+      const sys_info& __p = __periods[__k];
+      sys_seconds __sys   = __as_sys - __p.offset;
+      if (__sys >= __p.begin && __sys < __p.end) {
+        (__found == 0 ? __result.first : __result.second) = __p;
+        ++__found;
+      } else if (__found == 0 && __sys < __p.begin && __k != 0) {
+        // __time falls in the gap before this period.
+        __result.first  = __periods[__k - 1];
+        __result.second = __p;
+        return __result;
+      }
+    }
+    __result.result = __found == 2 ? local_info::ambiguous : local_info::unique;
+    return __result;
+  }
+};
+
+// The zones of a directory of TZif files, such as /usr/share/zoneinfo.
+//
+// The directory is the index: a zone is looked up by its path below the root,
+// read and parsed the first time it is requested, and kept for the lifetime of
+// the database. Using a zone never touches the files of the other zones.
+class tzif_database {
+public:
+  // The root is $TZDIR if it is set, and /usr/share/zoneinfo otherwise.
+  _LIBCPP_HIDE_FROM_ABI tzif_database() : __root_(__default_root()) {}
+  _LIBCPP_HIDE_FROM_ABI explicit tzif_database(string __root) : __root_(std::move(__root)) {}
+
+  tzif_database(const tzif_database&)            = delete;
+  tzif_database& operator=(const tzif_database&) = delete;
+
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const string& root() const noexcept { return __root_; }
+
+  // Returns nullptr if the zone does not exist or its file is not valid.
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const tzif_zone* __locate_zone(string_view __name) {
+#  if _LIBCPP_HAS_THREADS
+    lock_guard<mutex> __lock(__mut_);
+#  endif
+    auto __it = __zones_.find(__name);
+    if (__it != __zones_.end())
+      return __it->second.get();
+    unique_ptr<tzif_zone> __zone = __load(__name);
+    if (!__zone)
+      return nullptr;
+    const tzif_zone* __result = __zone.get();
+    __zones_.emplace(string(__name), std::move(__zone));
+    return __result;
+  }
+
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const tzif_zone* locate_zone(string_view __name) {
+    if (const tzif_zone* __result = __locate_zone(__name))
+      return __result;
+
+    std::__throw_runtime_error("tzif: requested time zone not found");
+  }
+
+  // The zone named by $TZ, or else the target of /etc/localtime, or else UTC.
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const tzif_zone* current_zone() {
+    if (const char* __tz = std::getenv("TZ")) {
+      string_view __name(__tz);
+      if (!__name.empty() && __name[0] == ':')
+        __name.remove_prefix(1);
+      if (const tzif_zone* __result = __locate_zone(__name))
+        return __result;
+    }
+#  if __has_include(<unistd.h>)
+    char __buf[1024];
+    ssize_t __len = ::readlink("/etc/localtime", __buf, sizeof(__buf));
+    if (__len > 0 && static_cast<size_t>(__len) < sizeof(__buf)) {
+      string_view __target(__buf, static_cast<size_t>(__len));
+      size_t __pos = __target.rfind("zoneinfo/");
+      if (__pos != string_view::npos)
+        if (const tzif_zone* __result = __locate_zone(__target.substr(__pos + 9)))
+          return __result;
+    }
+#  endif
+    return locate_zone("UTC");
+  }
+
+private:
+  _LIBCPP_HIDE_FROM_ABI static string __default_root() {
+    const char* __dir = std::getenv("TZDIR");
+    return __dir != nullptr && *__dir != '\0' ? string(__dir) : string("/usr/share/zoneinfo");
+  }
+
+  // Only names of files below the root are accepted.
+  _LIBCPP_HIDE_FROM_ABI static bool __valid_name(string_view __name) {
+    if (__name.empty() || __name[0] == '/')
+      return false;
+    for (size_t __i = 0; __i != __name.size();) {
+      size_t __next = __name.find('/', __i);
+      if (__next == string_view::npos)
+        __next = __name.size();
+      string_view __part = __name.substr(__i, __next - __i);
+      if (__part.empty() || __part == "." || __part == "..")
+        return false;
+      __i = __next == __name.size() ? __next : __next + 1;
+    }
+    return true;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI unique_ptr<tzif_zone> __load(string_view __name) const {
+    if (!__valid_name(__name))
+      return nullptr;
+    string __path = __root_;
+    __path += '/';
+    __path.append(__name);
+    FILE* __f = std::fopen(__path.c_str(), "rb");
+    if (__f == nullptr)
+      return nullptr;
+    vector<unsigned char> __data;
+    unsigned char __buf[4096];
+    for (size_t __n; (__n = std::fread(__buf, 1, sizeof(__buf), __f)) != 0;)
+      __data.insert(__data.end(), __buf, __buf + __n);
+    bool __error = std::ferror(__f) != 0;
+    std::fclose(__f);
+    if (__error)
+      return nullptr;
+    unique_ptr<tzif_zone> __zone(new tzif_zone(string(__name)));
+    if (!__zone->__parse(__data.data(), __data.size()))
+      return nullptr;
+    return __zone;
+  }
+
+  string __root_;
+#  if _LIBCPP_HAS_THREADS
+  mutex __mut_;
+#  endif
+  map<string, unique_ptr<tzif_zone>, less<>> __zones_;
+};
+
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI inline tzif_database& get_tzif_database() {
+  static tzif_database __db;
+  return __db;
+}
+
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI inline const tzif_zone* locate_tzif_zone(string_view __name) {
+  return chrono::get_tzif_database().locate_zone(__name);
+}
+
+template <>
+struct zoned_traits<const tzif_zone*> {
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI static const tzif_zone* default_zone() {
+    return chrono::locate_tzif_zone("UTC");
+  }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI static const tzif_zone* locate_zone(string_view __name) {
+    return chrono::locate_tzif_zone(__name);
+  }
+};
+
+} // namespace chrono
+
+#  endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_TIME_ZONE_DATABASE && _LIBCPP_HAS_FILESYSTEM &&
+         // _LIBCPP_HAS_LOCALIZATION
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP_HAS_EXPERIMENTAL_TZDB
+
+#endif // _LIBCPP___CHRONO_TZIF_ZONE_H
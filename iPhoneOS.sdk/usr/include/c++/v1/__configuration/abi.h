@@ -60,6 +60,12 @@
 #  define _LIBCPP_ABI_BAD_FUNCTION_CALL_GOOD_WHAT_MESSAGE
 // According to the Standard, `bitset::operator[] const` returns bool
 #  define _LIBCPP_ABI_BITSET_VECTOR_BOOL_CONST_SUBSCRIPT_RETURN_BOOL
+// Hash strings and memory with rapidhash in the headers instead of calling std::__hash_memory in the dylib. This
+// changes the values returned by std::hash.
+#  define _LIBCPP_ABI_INLINE_HASH_MEMORY
+// Run ECMAScript regexes without back references on a Thompson NFA instead of the backtracking engine. This adds a
+// member to basic_regex.
+#  define _LIBCPP_ABI_REGEX_NFA
 
 // In LLVM 20, we've changed to take these ABI breaks unconditionally. These flags only exist in case someone is running
 // into the static_asserts we added to catch the ABI break and don't care that it is one.
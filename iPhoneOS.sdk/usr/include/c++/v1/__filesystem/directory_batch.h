@@ -0,0 +1,280 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___FILESYSTEM_DIRECTORY_BATCH_H
+#define _LIBCPP___FILESYSTEM_DIRECTORY_BATCH_H
+
+#include <__atomic/atomic.h>
+#include <__condition_variable/condition_variable.h>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__exception/exception_ptr.h>
+#include <__filesystem/directory_entry.h>
+#include <__filesystem/directory_options.h>
+#include <__filesystem/file_type.h>
+#include <__filesystem/filesystem_error.h>
+#include <__filesystem/path.h>
+#include <__memory/unique_ptr.h>
+#include <__mutex/mutex.h>
+#include <__mutex/unique_lock.h>
+#include <__system_error/errc.h>
+#include <__system_error/error_category.h>
+#include <__system_error/error_code.h>
+#include <__thread/thread.h>
+#include <__utility/move.h>
+#include <__vector/vector.h>
+#include <cerrno>
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_FILESYSTEM && _LIBCPP_HAS_EXPERIMENTAL_DIRECTORY_BATCH &&                    \
+    !defined(_LIBCPP_WIN32API) && __has_include(<dirent.h>)
+#  include <dirent.h>
+#  define _LIBCPP_HAS_DIRECTORY_BATCH 1
+#else
+#  define _LIBCPP_HAS_DIRECTORY_BATCH 0
+#endif
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+#if _LIBCPP_HAS_DIRECTORY_BATCH
+
+_LIBCPP_BEGIN_NAMESPACE_FILESYSTEM
+
+_LIBCPP_AVAILABILITY_FILESYSTEM_LIBRARY_PUSH
+
+// Reads directories with readdir and builds the entries directly, with their
+// type cached from d_type, instead of going through a directory_iterator and
+// its shared __dir_stream one entry at a time.
+class __directory_reader {
+  _LIBCPP_HIDE_FROM_ABI static file_type __file_type(unsigned char __d_type) {
+    switch (__d_type) {
+#  if defined(DT_REG)
+    case DT_REG:
+      return file_type::regular;
+    case DT_DIR:
+      return file_type::directory;
+    case DT_LNK:
+      return file_type::symlink;
+    case DT_BLK:
+      return file_type::block;
+    case DT_CHR:
+      return file_type::character;
+    case DT_FIFO:
+      return file_type::fifo;
+    case DT_SOCK:
+      return file_type::socket;
+#  endif
+    default:
+      // The type is fetched on first use.
+      return file_type::none;
+    }
+  }
+
+public:
+  // Calls __f with each entry of __dir, other than . and ..
+  template <class _Fn>
+  _LIBCPP_HIDE_FROM_ABI static error_code __for_each(const path& __dir, _Fn& __f) {
+    unique_ptr<DIR, int (*)(DIR*)> __d(::opendir(__dir.c_str()), &::closedir);
+    if (!__d)
+      return error_code(errno, generic_category());
+    while (true) {
+      errno         = 0;
+      dirent* __ent = ::readdir(__d.get());
+      if (__ent == nullptr)
+        return errno == 0 ? error_code() : error_code(errno, generic_category());
+      const char* __name = __ent->d_name;
+      if (__name[0] == '.' && (__name[1] == '\0' || (__name[1] == '.' && __name[2] == '\0')))
+        continue;
+      directory_entry __e;
+      __e.__assign_iter_entry(__dir / __name, directory_entry::__create_iter_result(__file_type(__ent->d_type)));
+      __f(std::move(__e));
+    }
+  }
+};
+
+// Appends the entries of __dir to __out, in a single pass over the directory.
+_LIBCPP_HIDE_FROM_ABI inline void read_directory(const path& __dir, vector<directory_entry>& __out, error_code& __ec) {
+  auto __push = [&__out](directory_entry&& __e) { __out.push_back(std::move(__e)); };
+  __ec        = __directory_reader::__for_each(__dir, __push);
+}
+
+_LIBCPP_HIDE_FROM_ABI inline void read_directory(const path& __dir, vector<directory_entry>& __out) {
+  error_code __ec;
+  filesystem::read_directory(__dir, __out, __ec);
+  if (__ec)
+    filesystem::__throw_filesystem_error("in read_directory", __dir, __ec);
+}
+
+#  if _LIBCPP_HAS_THREADS
+
+struct parallel_walk_options {
+  unsigned thread_count     = 0; // 0 means thread::hardware_concurrency()
+  size_t batch_size         = 1024;
+  directory_options options = directory_options::none;
+};
+
+// Walks the tree below a directory on several threads. Each thread takes a
+// directory from a shared stack, reads it and pushes its subdirectories back,
+// so the work spreads over the threads as soon as the tree branches. Entries
+// are handed to the callback in batches, from all the threads concurrently,
+// and in no particular order. The first error or exception stops the walk.
+class __parallel_walk {
+  mutex __mut_;
+  condition_variable __cv_;
+  vector<path> __pending_;
+  size_t __busy_ = 0;
+  atomic<bool> __stop_{false};
+  error_code __ec_;
+  path __ec_path_;
+#    if _LIBCPP_HAS_EXCEPTIONS
+  exception_ptr __exception_;
+#    endif
+  const parallel_walk_options& __opts_;
+
+  _LIBCPP_HIDE_FROM_ABI void __fail(const path& __p, error_code __ec) {
+    unique_lock<mutex> __lock(__mut_);
+    if (!__stop_.load(memory_order_relaxed)) {
+      __ec_      = __ec;
+      __ec_path_ = __p;
+    }
+    __stop_.store(true, memory_order_relaxed);
+    __cv_.notify_all();
+  }
+
+  template <class _Fn>
+  _LIBCPP_HIDE_FROM_ABI void __visit(const path& __dir, vector<directory_entry>& __batch, _Fn& __f) {
+    vector<path> __subdirs;
+    bool __follow = bool(__opts_.options & directory_options::follow_directory_symlink);
+    auto __push   = [&](directory_entry&& __e) {
+      if (__stop_.load(memory_order_relaxed))
+        return;
+      error_code __ignored;
+      file_type __ft = __e.symlink_status(__ignored).type();
+      if (__ft == file_type::directory || (__ft == file_type::symlink && __follow && __e.is_directory(__ignored)))
+        __subdirs.push_back(__e.path());
+      __batch.push_back(std::move(__e));
+      if (__batch.size() >= __opts_.batch_size) {
+        __f(static_cast<const vector<directory_entry>&>(__batch));
+        __batch.clear();
+      }
+    };
+    error_code __ec = __directory_reader::__for_each(__dir, __push);
+    if (__ec && !(__ec == errc::permission_denied &&
+                  bool(__opts_.options & directory_options::skip_permission_denied))) {
+      __fail(__dir, __ec);
+      return;
+    }
+    if (__subdirs.empty())
+      return;
+    unique_lock<mutex> __lock(__mut_);
+    for (path& __p : __subdirs)
+      __pending_.push_back(std::move(__p));
+    __cv_.notify_all();
+  }
+
+  template <class _Fn>
+  _LIBCPP_HIDE_FROM_ABI void __work(_Fn& __f) {
+    vector<directory_entry> __batch;
+#    if _LIBCPP_HAS_EXCEPTIONS
+    try {
+#    endif
+      unique_lock<mutex> __lock(__mut_);
+      while (true) {
+        __cv_.wait(__lock, [this] {
+          return __stop_.load(memory_order_relaxed) || !__pending_.empty() || __busy_ == 0;
+        });
+        if (__stop_.load(memory_order_relaxed) || __pending_.empty())
+          break;
+        path __dir = std::move(__pending_.back());
+        __pending_.pop_back();
+        ++__busy_;
+        __lock.unlock();
+        __visit(__dir, __batch, __f);
+        __lock.lock();
+        if (--__busy_ == 0)
+          __cv_.notify_all();
+      }
+      __lock.unlock();
+      if (!__batch.empty() && !__stop_.load(memory_order_relaxed))
+        __f(static_cast<const vector<directory_entry>&>(__batch));
+#    if _LIBCPP_HAS_EXCEPTIONS
+    } catch (...) {
+      unique_lock<mutex> __lock(__mut_);
+      if (!__stop_.load(memory_order_relaxed))
+        __exception_ = std::current_exception();
+      __stop_.store(true, memory_order_relaxed);
+      __cv_.notify_all();
+    }
+#    endif
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI explicit __parallel_walk(const parallel_walk_options& __opts) : __opts_(__opts) {}
+
+  template <class _Fn>
+  _LIBCPP_HIDE_FROM_ABI error_code __run(const path& __root, _Fn& __f) {
+    __pending_.push_back(__root);
+    unsigned __n = __opts_.thread_count != 0 ? __opts_.thread_count : thread::hardware_concurrency();
+    vector<thread> __threads;
+    // The calling thread is one of the workers.
+#    if _LIBCPP_HAS_EXCEPTIONS
+    try {
+#    endif
+      for (unsigned __i = 1; __i < __n; ++__i)
+        __threads.emplace_back([this, &__f] { __work(__f); });
+#    if _LIBCPP_HAS_EXCEPTIONS
+    } catch (...) {
+      // Walk with the threads that could be started.
+    }
+#    endif
+    __work(__f);
+    for (thread& __t : __threads)
+      __t.join();
+#    if _LIBCPP_HAS_EXCEPTIONS
+    if (__exception_)
+      std::rethrow_exception(__exception_);
+#    endif
+    return __ec_;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI const path& __error_path() const { return __ec_path_; }
+};
+
+// Calls __f(const vector<directory_entry>&) with every entry below __root,
+// like recursive_directory_iterator, but from several threads at once.
+template <class _Fn>
+_LIBCPP_HIDE_FROM_ABI void
+parallel_recursive_walk(const path& __root, _Fn&& __f, const parallel_walk_options& __opts, error_code& __ec) {
+  __parallel_walk __walk(__opts);
+  __ec = __walk.__run(__root, __f);
+}
+
+template <class _Fn>
+_LIBCPP_HIDE_FROM_ABI void
+parallel_recursive_walk(const path& __root, _Fn&& __f, const parallel_walk_options& __opts = parallel_walk_options()) {
+  __parallel_walk __walk(__opts);
+  if (error_code __ec = __walk.__run(__root, __f))
+    filesystem::__throw_filesystem_error("in parallel_recursive_walk", __walk.__error_path(), __ec);
+}
+
+#  endif // _LIBCPP_HAS_THREADS
+
+_LIBCPP_AVAILABILITY_FILESYSTEM_LIBRARY_POP
+
+_LIBCPP_END_NAMESPACE_FILESYSTEM
+
+#endif // _LIBCPP_HAS_DIRECTORY_BATCH
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___FILESYSTEM_DIRECTORY_BATCH_H
@@ -197,6 +197,7 @@ private:
   friend class directory_iterator;
   friend class recursive_directory_iterator;
   friend class _LIBCPP_HIDDEN __dir_stream;
+  friend class __directory_reader;
 
   enum _CacheType : unsigned char {
     _Empty,
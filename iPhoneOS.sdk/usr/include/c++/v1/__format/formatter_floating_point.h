@@ -122,6 +122,9 @@ struct __traits<float> {
   static constexpr int __max_fractional       = 149;
   static constexpr int __max_fractional_value = 3;
   static constexpr size_t __stack_buffer_size = 256;
+  // The shortest round-trip representation is at most 17 code units, the
+  // sign and the radix point of the alternate form included.
+  static constexpr size_t __max_shortest_size = 24;
 
   static constexpr int __hex_precision_digits = 3;
 };
@@ -132,6 +135,9 @@ struct __traits<double> {
   static constexpr int __max_fractional       = 1074;
   static constexpr int __max_fractional_value = 4;
   static constexpr size_t __stack_buffer_size = 1024;
+  // The shortest round-trip representation is at most 25 code units, the
+  // sign and the radix point of the alternate form included.
+  static constexpr size_t __max_shortest_size = 32;
 
   static constexpr int __hex_precision_digits = 4;
 };
@@ -155,6 +161,15 @@ public:
   // required.
   explicit _LIBCPP_HIDE_FROM_ABI __float_buffer(int __precision)
       : __precision_(__precision != -1 ? __precision : _Traits::__max_fractional) {
+    // Without a precision the value is written in its shortest round-trip
+    // form, which is small. This avoids sizing the buffer for the worst case
+    // fixed notation, which for double exceeds the stack buffer.
+    if (__precision == -1) {
+      __size_  = _Traits::__max_shortest_size;
+      __begin_ = __buffer_;
+      return;
+    }
+
     // When the precision is larger than _Traits::__max_fractional the digits in
     // the range (_Traits::__max_fractional, precision] will contain the value
     // zero. There's no need to request to_chars to write these zeros:
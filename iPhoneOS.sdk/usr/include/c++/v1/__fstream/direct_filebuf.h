@@ -0,0 +1,419 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___FSTREAM_DIRECT_FILEBUF_H
+#define _LIBCPP___FSTREAM_DIRECT_FILEBUF_H
+
+#include <__config>
+#include <__filesystem/path.h>
+#include <__memory/addressof.h>
+#include <__new/allocate.h>
+#include <__string/char_traits.h>
+#include <__utility/element_count.h>
+#include <__utility/swap.h>
+#include <cerrno>
+#include <cstdint>
+#include <ios>
+#include <streambuf>
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_DIRECT_FILEBUF && __has_include(<sys/uio.h>)
+#  include <fcntl.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#endif
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_DIRECT_FILEBUF && __has_include(<sys/uio.h>)
+
+struct direct_io_t {
+  explicit direct_io_t() = default;
+};
+
+inline constexpr direct_io_t direct_io{};
+
+// A write-only file stream buffer that writes straight to a file descriptor.
+//
+// basic_filebuf hands its put area to fwrite, which copies it again into the
+// stdio buffer of the FILE. This buffer has a single, larger buffer, by default
+// __default_buffer_size bytes, and writes it out with write(2). setbuf sets its
+// size, or supplies it. A write that does not fit in the remaining space is
+// sent together with the buffered output in a single writev(2), without being
+// copied.
+//
+// Opening the file with direct_io bypasses the page cache: with O_DIRECT where
+// it exists, F_NOCACHE on Apple platforms. O_DIRECT needs the buffer, the
+// length and the file offset of every write aligned to __block_size, so the
+// buffer is aligned and its size rounded up, a full buffer is written as whole
+// blocks, and only sync() and close() write a partial block, with O_DIRECT
+// turned off until the offset is aligned again. Writes that O_DIRECT rejects
+// anyway are retried without it.
+template <class _CharT, class _Traits = char_traits<_CharT> >
+class basic_direct_filebuf : public basic_streambuf<_CharT, _Traits> {
+  static_assert(sizeof(_CharT) == 1, "basic_direct_filebuf writes the characters as bytes");
+
+public:
+  typedef _CharT char_type;
+  typedef _Traits traits_type;
+  typedef typename traits_type::int_type int_type;
+  typedef typename traits_type::pos_type pos_type;
+  typedef typename traits_type::off_type off_type;
+
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf()
+      : __fd_(-1),
+        __buf_(nullptr),
+        __buf_size_(__default_buffer_size),
+        __owns_buf_(false),
+        __direct_(false),
+        __direct_on_(false),
+        __offset_(0) {}
+
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf(basic_direct_filebuf&& __rhs)
+      : basic_streambuf<_CharT, _Traits>(__rhs),
+        __fd_(__rhs.__fd_),
+        __buf_(__rhs.__buf_),
+        __buf_size_(__rhs.__buf_size_),
+        __owns_buf_(__rhs.__owns_buf_),
+        __direct_(__rhs.__direct_),
+        __direct_on_(__rhs.__direct_on_),
+        __offset_(__rhs.__offset_) {
+    __rhs.__fd_        = -1;
+    __rhs.__buf_       = nullptr;
+    __rhs.__owns_buf_  = false;
+    __rhs.__direct_    = false;
+    __rhs.__direct_on_ = false;
+    __rhs.setp(nullptr, nullptr);
+  }
+
+  basic_direct_filebuf(const basic_direct_filebuf&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI ~basic_direct_filebuf() override {
+    close();
+    __release_buffer();
+  }
+
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf& operator=(basic_direct_filebuf&& __rhs) {
+    close();
+    swap(__rhs);
+    return *this;
+  }
+
+  basic_direct_filebuf& operator=(const basic_direct_filebuf&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI void swap(basic_direct_filebuf& __rhs) {
+    basic_streambuf<_CharT, _Traits>::swap(__rhs);
+    std::swap(__fd_, __rhs.__fd_);
+    std::swap(__buf_, __rhs.__buf_);
+    std::swap(__buf_size_, __rhs.__buf_size_);
+    std::swap(__owns_buf_, __rhs.__owns_buf_);
+    std::swap(__direct_, __rhs.__direct_);
+    std::swap(__direct_on_, __rhs.__direct_on_);
+    std::swap(__offset_, __rhs.__offset_);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool is_open() const { return __fd_ != -1; }
+
+  // Supports the write-only modes of basic_filebuf: out, out | trunc, app,
+  // out | app and out | noreplace, each optionally with ate and binary.
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf* open(const char* __s, ios_base::openmode __mode = ios_base::out) {
+    return __open(__s, __mode, false);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf* open(const char* __s, ios_base::openmode __mode, direct_io_t) {
+    return __open(__s, __mode, true);
+  }
+
+  _LIBCPP_AVAILABILITY_FILESYSTEM_LIBRARY _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf*
+  open(const filesystem::path& __p, ios_base::openmode __mode = ios_base::out) {
+    return __open(__p.c_str(), __mode, false);
+  }
+
+  _LIBCPP_AVAILABILITY_FILESYSTEM_LIBRARY _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf*
+  open(const filesystem::path& __p, ios_base::openmode __mode, direct_io_t) {
+    return __open(__p.c_str(), __mode, true);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf* close() {
+    if (__fd_ == -1)
+      return nullptr;
+    basic_direct_filebuf* __rt = __flush(true) ? this : nullptr;
+    if (::close(__fd_) != 0)
+      __rt = nullptr;
+    __fd_        = -1;
+    __direct_    = false;
+    __direct_on_ = false;
+    this->setp(nullptr, nullptr);
+    return __rt;
+  }
+
+protected:
+  // Flushes the buffered output, then uses [__s, __s + __n) as the buffer if
+  // __s is not null, or a buffer of __n bytes allocated on the first write.
+  // A size of zero makes the stream unbuffered.
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL basic_streambuf<char_type, traits_type>*
+  setbuf(char_type* __s, streamsize __n) override {
+    if (__n < 0 || (__fd_ != -1 && !__flush(true)))
+      return nullptr;
+    __release_buffer();
+    this->setp(nullptr, nullptr);
+    __buf_size_ = static_cast<size_t>(__n);
+    if (__s != nullptr && __n != 0) {
+      __buf_ = __s;
+      this->setp(__buf_, __buf_ + __buf_size_);
+    }
+    return this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL int_type overflow(int_type __c = traits_type::eof()) override {
+    if (__fd_ == -1 || !__flush(false))
+      return traits_type::eof();
+    if (traits_type::eq_int_type(__c, traits_type::eof()))
+      return traits_type::not_eof(__c);
+    if (!__ensure_buffer()) {
+      char_type __ch = traits_type::to_char_type(__c);
+      return __write(std::addressof(__ch), 1) ? __c : traits_type::eof();
+    }
+    *this->pptr() = traits_type::to_char_type(__c);
+    this->pbump(1);
+    return __c;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL streamsize xsputn(const char_type* __s, streamsize __n) override {
+    if (__fd_ == -1 || __n <= 0)
+      return 0;
+    __ensure_buffer();
+    size_t __len = static_cast<size_t>(__n);
+    if (__len <= static_cast<size_t>(this->epptr() - this->pptr())) {
+      traits_type::copy(this->pptr(), __s, __len);
+      this->__pbump(__n);
+      return __n;
+    }
+    // Direct I/O has to go through the aligned buffer.
+    if (__direct_)
+      return basic_streambuf<_CharT, _Traits>::xsputn(__s, __n);
+    if (!__write(this->pbase(), static_cast<size_t>(this->pptr() - this->pbase()), __s, __len))
+      return 0;
+    this->setp(this->pbase(), this->epptr());
+    return __n;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL int sync() override { return __fd_ == -1 || __flush(true) ? 0 : -1; }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL pos_type
+  seekoff(off_type __off, ios_base::seekdir __way, ios_base::openmode __which = ios_base::in | ios_base::out) override {
+    if (__fd_ == -1 || !(__which & ios_base::out) || !__flush(true))
+      return pos_type(off_type(-1));
+    int __whence;
+    switch (__way) {
+    case ios_base::beg:
+      __whence = SEEK_SET;
+      break;
+    case ios_base::cur:
+      __whence = SEEK_CUR;
+      break;
+    case ios_base::end:
+      __whence = SEEK_END;
+      break;
+    default:
+      return pos_type(off_type(-1));
+    }
+    off_t __r = ::lseek(__fd_, static_cast<off_t>(__off), __whence);
+    if (__r == -1)
+      return pos_type(off_type(-1));
+    __offset_ = __r;
+    return pos_type(off_type(__r));
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL pos_type
+  seekpos(pos_type __sp, ios_base::openmode __which = ios_base::in | ios_base::out) override {
+    return seekoff(off_type(__sp), ios_base::beg, __which);
+  }
+
+private:
+  static constexpr size_t __default_buffer_size = size_t(1) << 16;
+  static constexpr size_t __block_size          = 4096;
+
+  int __fd_;
+  char_type* __buf_;
+  size_t __buf_size_;
+  bool __owns_buf_;
+  bool __direct_;
+  bool __direct_on_; // whether O_DIRECT is currently set on __fd_
+  off_t __offset_;   // the file offset, only used to keep direct I/O aligned
+
+  _LIBCPP_HIDE_FROM_ABI basic_direct_filebuf* __open(const char* __s, ios_base::openmode __mode, bool __direct) {
+    if (__fd_ != -1)
+      return nullptr;
+    int __flags = O_WRONLY | O_CREAT | O_CLOEXEC;
+    switch (__mode & ~(ios_base::ate | ios_base::binary)) {
+    case ios_base::out:
+    case ios_base::out | ios_base::trunc:
+      __flags |= O_TRUNC;
+      break;
+    case ios_base::app:
+    case ios_base::out | ios_base::app:
+      __flags |= O_APPEND;
+      break;
+#  if _LIBCPP_STD_VER >= 23
+    case ios_base::out | ios_base::noreplace:
+    case ios_base::out | ios_base::trunc | ios_base::noreplace:
+      __flags |= O_TRUNC | O_EXCL;
+      break;
+#  endif
+    default:
+      return nullptr;
+    }
+    int __fd = -1;
+#  if defined(O_DIRECT)
+    // Not every file system supports O_DIRECT.
+    if (__direct) {
+      __fd         = ::open(__s, __flags | O_DIRECT, 0666);
+      __direct_on_ = __fd != -1;
+    }
+#  endif
+    if (__fd == -1)
+      __fd = ::open(__s, __flags, 0666);
+    if (__fd == -1)
+      return nullptr;
+#  if defined(F_NOCACHE)
+    if (__direct)
+      ::fcntl(__fd, F_NOCACHE, 1);
+#  endif
+    off_t __offset = ::lseek(__fd, 0, (__mode & (ios_base::app | ios_base::ate)) ? SEEK_END : SEEK_CUR);
+    if (__offset == -1) {
+      ::close(__fd);
+      __direct_on_ = false;
+      return nullptr;
+    }
+    __fd_     = __fd;
+    __direct_ = __direct;
+    __offset_ = __offset;
+    return this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __release_buffer() {
+    if (__owns_buf_)
+      std::__libcpp_deallocate<char_type>(__buf_, __element_count(__buf_size_), __block_size);
+    __buf_      = nullptr;
+    __owns_buf_ = false;
+  }
+
+  // Sets up the put area, allocating the buffer if needed. Returns false if the stream is unbuffered.
+  _LIBCPP_HIDE_FROM_ABI bool __ensure_buffer() {
+    if (this->pbase() != nullptr)
+      return true;
+    if (__buf_size_ == 0)
+      return false;
+    if (__buf_ == nullptr) {
+      if (__direct_)
+        __buf_size_ = (__buf_size_ + __block_size - 1) & ~(__block_size - 1);
+      __buf_      = std::__libcpp_allocate<char_type>(__element_count(__buf_size_), __block_size);
+      __owns_buf_ = true;
+    }
+    this->setp(__buf_, __buf_ + __buf_size_);
+    return true;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __set_direct(bool __on) {
+#  if defined(O_DIRECT)
+    if (__on == __direct_on_)
+      return;
+    int __flags = ::fcntl(__fd_, F_GETFL);
+    if (__flags == -1 || ::fcntl(__fd_, F_SETFL, __on ? __flags | O_DIRECT : __flags & ~O_DIRECT) == -1)
+      return;
+    __direct_on_ = __on;
+#  else
+    (void)__on;
+#  endif
+  }
+
+  // Writes [__p, __p + __n) and then [__q, __q + __m), with as few system calls as possible.
+  _LIBCPP_HIDE_FROM_ABI bool __write(const char_type* __p, size_t __n, const char_type* __q = nullptr, size_t __m = 0) {
+    while (__n + __m != 0) {
+      iovec __iov[2] = {{const_cast<char_type*>(__p), __n}, {const_cast<char_type*>(__q), __m}};
+      ssize_t __r    = __n == 0 ? ::write(__fd_, __q, __m) : ::writev(__fd_, __iov, __m == 0 ? 1 : 2);
+      if (__r < 0) {
+        if (errno == EINTR)
+          continue;
+        if (errno == EINVAL && __direct_on_) {
+          __set_direct(false);
+          if (!__direct_on_)
+            continue;
+        }
+        return false;
+      }
+      __offset_ += __r;
+      size_t __done = static_cast<size_t>(__r);
+      if (__done < __n) {
+        __p += __done;
+        __n -= __done;
+      } else {
+        __q += __done - __n;
+        __m -= __done - __n;
+        __n = 0;
+      }
+    }
+    return true;
+  }
+
+  // Writes out the put area. Unless __all is set, direct I/O only writes whole
+  // blocks and keeps the rest at the front of the buffer.
+  _LIBCPP_HIDE_FROM_ABI bool __flush(bool __all) {
+    char_type* __b = this->pbase();
+    size_t __n     = static_cast<size_t>(this->pptr() - __b);
+    if (__n == 0)
+      return true;
+    if (__direct_) {
+      bool __aligned =
+          __offset_ % __block_size == 0 && reinterpret_cast<uintptr_t>(__b) % __block_size == 0 && __n >= __block_size;
+      if (__aligned) {
+        size_t __whole = __n & ~(__block_size - 1);
+        __set_direct(true);
+        if (!__write(__b, __whole))
+          return false;
+        if (!__all) {
+          traits_type::move(__b, __b + __whole, __n - __whole);
+          this->setp(__b, this->epptr());
+          this->__pbump(static_cast<streamsize>(__n - __whole));
+          return true;
+        }
+        __b += __whole;
+        __n -= __whole;
+      }
+      __set_direct(false);
+    }
+    if (!__write(__b, __n))
+      return false;
+    this->setp(this->pbase(), this->epptr());
+    return true;
+  }
+};
+
+template <class _CharT, class _Traits>
+inline _LIBCPP_HIDE_FROM_ABI void
+swap(basic_direct_filebuf<_CharT, _Traits>& __x, basic_direct_filebuf<_CharT, _Traits>& __y) {
+  __x.swap(__y);
+}
+
+using direct_filebuf = basic_direct_filebuf<char>;
+
+#endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_DIRECT_FILEBUF && __has_include(<sys/uio.h>)
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___FSTREAM_DIRECT_FILEBUF_H
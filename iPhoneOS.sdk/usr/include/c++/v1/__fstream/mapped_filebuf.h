@@ -0,0 +1,262 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___FSTREAM_MAPPED_FILEBUF_H
+#define _LIBCPP___FSTREAM_MAPPED_FILEBUF_H
+
+#include <__config>
+#include <__filesystem/path.h>
+#include <__string/char_traits.h>
+#include <__utility/swap.h>
+#include <ios>
+#include <streambuf>
+#include <string>
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_MAPPED_FILEBUF && __has_include(<sys/mman.h>)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_MAPPED_FILEBUF && __has_include(<sys/mman.h>)
+
+// A read-only file stream buffer that maps the file into memory.
+//
+// basic_filebuf reads the file with fread into its own buffer, so every byte is
+// copied twice before the stream sees it. This buffer maps the whole file and
+// its get area points straight into the mapping: there is no copy, and seeking
+// is pointer arithmetic.
+//
+// The get area always starts at the beginning of the file, so putback works up
+// to the first character, but only extends a window past the current position.
+// Crossing the end of the window calls underflow(), which moves the window and
+// asks the kernel to start reading the next one in. setbuf(nullptr, __n) sets
+// the size of the window; the buffer argument is ignored.
+//
+// The file is read as raw bytes, without any conversion. As with any mapping,
+// truncating the file while it is mapped makes reading the lost pages fault.
+template <class _CharT, class _Traits = char_traits<_CharT> >
+class basic_mapped_filebuf : public basic_streambuf<_CharT, _Traits> {
+  static_assert(sizeof(_CharT) == 1, "basic_mapped_filebuf reads the bytes of the file as characters");
+
+public:
+  typedef _CharT char_type;
+  typedef _Traits traits_type;
+  typedef typename traits_type::int_type int_type;
+  typedef typename traits_type::pos_type pos_type;
+  typedef typename traits_type::off_type off_type;
+
+  _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf()
+      : __base_(nullptr), __size_(0), __window_(__default_window), __is_open_(false) {}
+
+  _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf(basic_mapped_filebuf&& __rhs)
+      : basic_streambuf<_CharT, _Traits>(__rhs),
+        __base_(__rhs.__base_),
+        __size_(__rhs.__size_),
+        __window_(__rhs.__window_),
+        __is_open_(__rhs.__is_open_) {
+    __rhs.__base_    = nullptr;
+    __rhs.__size_    = 0;
+    __rhs.__is_open_ = false;
+    __rhs.setg(nullptr, nullptr, nullptr);
+  }
+
+  basic_mapped_filebuf(const basic_mapped_filebuf&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI ~basic_mapped_filebuf() override { close(); }
+
+  _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf& operator=(basic_mapped_filebuf&& __rhs) {
+    close();
+    swap(__rhs);
+    return *this;
+  }
+
+  basic_mapped_filebuf& operator=(const basic_mapped_filebuf&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI void swap(basic_mapped_filebuf& __rhs) {
+    basic_streambuf<_CharT, _Traits>::swap(__rhs);
+    std::swap(__base_, __rhs.__base_);
+    std::swap(__size_, __rhs.__size_);
+    std::swap(__window_, __rhs.__window_);
+    std::swap(__is_open_, __rhs.__is_open_);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool is_open() const { return __is_open_; }
+
+  // Only ios_base::in is supported; ios_base::ate starts reading at the end of
+  // the file and ios_base::binary makes no difference.
+  _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf* open(const char* __s, ios_base::openmode __mode = ios_base::in) {
+    if (__is_open_ || (__mode & (ios_base::out | ios_base::app | ios_base::trunc)) || !(__mode & ios_base::in))
+      return nullptr;
+    int __fd = ::open(__s, O_RDONLY | O_CLOEXEC);
+    if (__fd == -1)
+      return nullptr;
+    struct stat __st;
+    if (::fstat(__fd, &__st) != 0 || !S_ISREG(__st.st_mode) ||
+        static_cast<unsigned long long>(__st.st_size) > static_cast<size_t>(-1) / 2) {
+      ::close(__fd);
+      return nullptr;
+    }
+    size_t __size = static_cast<size_t>(__st.st_size);
+    void* __map   = nullptr;
+    if (__size != 0) {
+      __map = ::mmap(nullptr, __size, PROT_READ, MAP_PRIVATE, __fd, 0);
+      if (__map == MAP_FAILED) {
+        ::close(__fd);
+        return nullptr;
+      }
+      ::madvise(__map, __size, MADV_SEQUENTIAL);
+    }
+    // The mapping keeps the file alive.
+    ::close(__fd);
+    __base_    = static_cast<char_type*>(__map);
+    __size_    = __size;
+    __is_open_ = true;
+    __expose(__mode & ios_base::ate ? __size_ : 0);
+    return this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf* open(const string& __s, ios_base::openmode __mode = ios_base::in) {
+    return open(__s.c_str(), __mode);
+  }
+
+  _LIBCPP_AVAILABILITY_FILESYSTEM_LIBRARY _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf*
+  open(const filesystem::path& __p, ios_base::openmode __mode = ios_base::in) {
+    return open(__p.c_str(), __mode);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI basic_mapped_filebuf* close() {
+    if (!__is_open_)
+      return nullptr;
+    if (__base_ != nullptr)
+      ::munmap(__base_, __size_);
+    __base_    = nullptr;
+    __size_    = 0;
+    __is_open_ = false;
+    this->setg(nullptr, nullptr, nullptr);
+    return this;
+  }
+
+protected:
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL basic_streambuf<char_type, traits_type>* setbuf(char_type*, streamsize __n) override {
+    if (__n > 0) {
+      __window_ = static_cast<size_t>(__n);
+      if (__is_open_)
+        __expose(__position());
+    }
+    return this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL int_type underflow() override {
+    size_t __pos = __position();
+    if (!__is_open_ || __pos == __size_)
+      return traits_type::eof();
+    __expose(__pos);
+    return traits_type::to_int_type(*this->gptr());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL streamsize showmanyc() override {
+    size_t __pos = __position();
+    return __is_open_ && __pos != __size_ ? static_cast<streamsize>(__size_ - __pos) : -1;
+  }
+
+  // Copies straight out of the mapping, without going through the window.
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL streamsize xsgetn(char_type* __s, streamsize __n) override {
+    size_t __pos = __position();
+    size_t __len = __size_ - __pos;
+    if (__n <= 0 || __len == 0)
+      return 0;
+    if (static_cast<size_t>(__n) < __len)
+      __len = static_cast<size_t>(__n);
+    traits_type::copy(__s, this->gptr(), __len);
+    if (__len < static_cast<size_t>(this->egptr() - this->gptr()))
+      this->setg(this->eback(), this->gptr() + __len, this->egptr());
+    else
+      __expose(__pos + __len);
+    return static_cast<streamsize>(__len);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL pos_type
+  seekoff(off_type __off, ios_base::seekdir __way, ios_base::openmode __which = ios_base::in | ios_base::out) override {
+    if (!__is_open_ || !(__which & ios_base::in))
+      return pos_type(off_type(-1));
+    off_type __from;
+    switch (__way) {
+    case ios_base::beg:
+      __from = 0;
+      break;
+    case ios_base::cur:
+      __from = static_cast<off_type>(__position());
+      break;
+    case ios_base::end:
+      __from = static_cast<off_type>(__size_);
+      break;
+    default:
+      return pos_type(off_type(-1));
+    }
+    if (__off < -__from || __off > static_cast<off_type>(__size_) - __from)
+      return pos_type(off_type(-1));
+    __expose(static_cast<size_t>(__from + __off));
+    return pos_type(__from + __off);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL pos_type
+  seekpos(pos_type __sp, ios_base::openmode __which = ios_base::in | ios_base::out) override {
+    return seekoff(off_type(__sp), ios_base::beg, __which);
+  }
+
+private:
+  static constexpr size_t __default_window = size_t(1) << 20;
+
+  char_type* __base_;
+  size_t __size_;
+  size_t __window_;
+  bool __is_open_;
+
+  _LIBCPP_HIDE_FROM_ABI size_t __position() const { return static_cast<size_t>(this->gptr() - this->eback()); }
+
+  // Makes [0, __pos + __window_) the get area, positioned at __pos, and starts
+  // reading the window after it in.
+  _LIBCPP_HIDE_FROM_ABI void __expose(size_t __pos) {
+    size_t __end = __size_ - __pos > __window_ ? __pos + __window_ : __size_;
+    this->setg(__base_, __base_ + __pos, __base_ + __end);
+    if (__end == __size_)
+      return;
+    static const size_t __page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t __first             = __end & ~(__page - 1);
+    size_t __last              = __size_ - __end > __window_ ? __end + __window_ : __size_;
+    ::madvise(__base_ + __first, __last - __first, MADV_WILLNEED);
+  }
+};
+
+template <class _CharT, class _Traits>
+inline _LIBCPP_HIDE_FROM_ABI void
+swap(basic_mapped_filebuf<_CharT, _Traits>& __x, basic_mapped_filebuf<_CharT, _Traits>& __y) {
+  __x.swap(__y);
+}
+
+using mapped_filebuf = basic_mapped_filebuf<char>;
+
+#endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_MAPPED_FILEBUF && __has_include(<sys/mman.h>)
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___FSTREAM_MAPPED_FILEBUF_H
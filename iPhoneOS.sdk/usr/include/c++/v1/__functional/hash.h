@@ -11,6 +11,7 @@
 
 #include <__config>
 #include <__cstddef/nullptr_t.h>
+#include <__functional/hash_bytes.h>
 #include <__functional/unary_function.h>
 #include <__fwd/functional.h>
 #include <__memory/addressof.h>
@@ -241,7 +242,14 @@ private:
   }
 };
 
-#if _LIBCPP_AVAILABILITY_HAS_HASH_MEMORY
+#if defined(_LIBCPP_ABI_INLINE_HASH_MEMORY)
+// Hash the bytes in the header, so the hash of a short key is a handful of inlined instructions instead of a call into
+// the dylib. This changes the value of std::hash for strings and large scalars, which must not differ between the
+// translation units sharing an unordered container, hence the ABI flag.
+_LIBCPP_HIDE_FROM_ABI inline size_t __hash_memory(const void* __ptr, size_t __size) _NOEXCEPT {
+  return static_cast<size_t>(__rapidhash()(__ptr, __size, 0));
+}
+#elif _LIBCPP_AVAILABILITY_HAS_HASH_MEMORY
 [[__gnu__::__pure__]] _LIBCPP_EXPORTED_FROM_ABI size_t __hash_memory(_LIBCPP_NOESCAPE const void*, size_t) _NOEXCEPT;
 #else
 _LIBCPP_HIDE_FROM_ABI inline size_t __hash_memory(const void* __ptr, size_t __size) _NOEXCEPT {
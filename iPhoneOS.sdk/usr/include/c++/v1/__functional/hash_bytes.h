@@ -0,0 +1,148 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___FUNCTIONAL_HASH_BYTES_H
+#define _LIBCPP___FUNCTIONAL_HASH_BYTES_H
+
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__memory/addressof.h>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+// rapidhash (https://github.com/Nicoshev/rapidhash), a successor of wyhash. Short keys are hashed with a couple of
+// overlapping loads and a single 64 x 64 -> 128 bit multiplication, without a loop, and long keys with three
+// independent multiplication chains. The bytes are always read as little endian, so the result only depends on the
+// bytes, the size and the seed, on every platform.
+struct __rapidhash {
+  static const uint64_t __secret0 = 0x2d358dccaa6c78a5ull;
+  static const uint64_t __secret1 = 0x8bb84b93962eacc9ull;
+  static const uint64_t __secret2 = 0x4b33a62ed433d4a3ull;
+
+  _LIBCPP_HIDE_FROM_ABI static uint64_t __read64(const unsigned char* __p) _NOEXCEPT {
+    uint64_t __v;
+    __builtin_memcpy(std::addressof(__v), __p, sizeof(__v));
+#ifdef _LIBCPP_BIG_ENDIAN
+    __v = __builtin_bswap64(__v);
+#endif
+    return __v;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static uint64_t __read32(const unsigned char* __p) _NOEXCEPT {
+    uint32_t __v;
+    __builtin_memcpy(std::addressof(__v), __p, sizeof(__v));
+#ifdef _LIBCPP_BIG_ENDIAN
+    __v = __builtin_bswap32(__v);
+#endif
+    return __v;
+  }
+
+  // Reads 1 to 3 bytes.
+  _LIBCPP_HIDE_FROM_ABI static uint64_t __read_small(const unsigned char* __p, size_t __n) _NOEXCEPT {
+    return (static_cast<uint64_t>(__p[0]) << 56) | (static_cast<uint64_t>(__p[__n >> 1]) << 32) | __p[__n - 1];
+  }
+
+  // Replaces __a and __b by the low and high halves of their product.
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_DISABLE_UBSAN_UNSIGNED_INTEGER_CHECK static void
+  __mum(uint64_t& __a, uint64_t& __b) _NOEXCEPT {
+#if _LIBCPP_HAS_INT128
+    __uint128_t __r = static_cast<__uint128_t>(__a) * __b;
+    __a             = static_cast<uint64_t>(__r);
+    __b             = static_cast<uint64_t>(__r >> 64);
+#else
+    // 32 x 32 -> 64 bit partial products.
+    uint64_t __ha  = __a >> 32;
+    uint64_t __hb  = __b >> 32;
+    uint64_t __la  = static_cast<uint32_t>(__a);
+    uint64_t __lb  = static_cast<uint32_t>(__b);
+    uint64_t __rh  = __ha * __hb;
+    uint64_t __rm0 = __ha * __lb;
+    uint64_t __rm1 = __hb * __la;
+    uint64_t __rl  = __la * __lb;
+    uint64_t __t   = __rl + (__rm0 << 32);
+    uint64_t __c   = __t < __rl;
+    uint64_t __lo  = __t + (__rm1 << 32);
+    __c += __lo < __t;
+    __a = __lo;
+    __b = __rh + (__rm0 >> 32) + (__rm1 >> 32) + __c;
+#endif
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static uint64_t __mix(uint64_t __a, uint64_t __b) _NOEXCEPT {
+    __rapidhash::__mum(__a, __b);
+    return __a ^ __b;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI _LIBCPP_DISABLE_UBSAN_UNSIGNED_INTEGER_CHECK uint64_t
+  operator()(const void* __key, size_t __len, uint64_t __seed) const _NOEXCEPT {
+    const unsigned char* __p = static_cast<const unsigned char*>(__key);
+    __seed ^= __rapidhash::__mix(__seed ^ __secret0, __secret1) ^ __len;
+    uint64_t __a, __b;
+    if (__len <= 16) {
+      if (__len >= 4) {
+        // Two pairs of possibly overlapping 4 byte loads cover every byte.
+        const unsigned char* __plast = __p + __len - 4;
+        size_t __delta               = (__len & 24) >> (__len >> 3);
+        __a                          = (__read32(__p) << 32) | __read32(__plast);
+        __b                          = (__read32(__p + __delta) << 32) | __read32(__plast - __delta);
+      } else if (__len > 0) {
+        __a = __read_small(__p, __len);
+        __b = 0;
+      } else {
+        __a = __b = 0;
+      }
+    } else {
+      size_t __i = __len;
+      if (__i > 48) {
+        uint64_t __see1 = __seed, __see2 = __seed;
+        do {
+          __seed = __rapidhash::__mix(__read64(__p) ^ __secret0, __read64(__p + 8) ^ __seed);
+          __see1 = __rapidhash::__mix(__read64(__p + 16) ^ __secret1, __read64(__p + 24) ^ __see1);
+          __see2 = __rapidhash::__mix(__read64(__p + 32) ^ __secret2, __read64(__p + 40) ^ __see2);
+          __p += 48;
+          __i -= 48;
+        } while (__i >= 48);
+        __seed ^= __see1 ^ __see2;
+      }
+      if (__i > 16) {
+        __seed = __rapidhash::__mix(__read64(__p) ^ __secret2, __read64(__p + 8) ^ __seed ^ __secret1);
+        if (__i > 32)
+          __seed = __rapidhash::__mix(__read64(__p + 16) ^ __secret2, __read64(__p + 24) ^ __seed);
+      }
+      // The last 16 bytes, which may overlap the ones already hashed.
+      __a = __read64(__p + __i - 16);
+      __b = __read64(__p + __i - 8);
+    }
+    __a ^= __secret1;
+    __b ^= __seed;
+    __rapidhash::__mum(__a, __b);
+    return __rapidhash::__mix(__a ^ __secret0 ^ __len, __b ^ __secret1);
+  }
+};
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_HASH_BYTES
+
+// Returns a 64 bit hash of the __size bytes at __ptr. Unlike std::hash, the result is specified: it only depends on
+// the bytes and the seed, and is the same across platforms and library versions, so it can be persisted or sent over
+// the network.
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI inline uint64_t
+hash_bytes(const void* __ptr, size_t __size, uint64_t __seed = 0) noexcept {
+  return __rapidhash()(__ptr, __size, __seed);
+}
+
+#endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_HASH_BYTES
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___FUNCTIONAL_HASH_BYTES_H
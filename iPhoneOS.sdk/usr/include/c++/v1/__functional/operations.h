@@ -203,6 +203,9 @@ struct bit_and : __binary_function<_Tp, _Tp, _Tp> {
 };
 _LIBCPP_CTAD_SUPPORTED_FOR_TYPE(bit_and);
 
+template <class _Tp>
+inline const bool __desugars_to_v<__bit_and_tag, bit_and<_Tp>, _Tp, _Tp> = true;
+
 #if _LIBCPP_STD_VER >= 14
 template <>
 struct bit_and<void> {
@@ -214,6 +217,9 @@ struct bit_and<void> {
   }
   typedef void is_transparent;
 };
+
+template <class _Tp, class _Up>
+inline const bool __desugars_to_v<__bit_and_tag, bit_and<void>, _Tp, _Up> = true;
 #endif
 
 #if _LIBCPP_STD_VER >= 14
@@ -248,6 +254,9 @@ struct bit_or : __binary_function<_Tp, _Tp, _Tp> {
 };
 _LIBCPP_CTAD_SUPPORTED_FOR_TYPE(bit_or);
 
+template <class _Tp>
+inline const bool __desugars_to_v<__bit_or_tag, bit_or<_Tp>, _Tp, _Tp> = true;
+
 #if _LIBCPP_STD_VER >= 14
 template <>
 struct bit_or<void> {
@@ -259,6 +268,9 @@ struct bit_or<void> {
   }
   typedef void is_transparent;
 };
+
+template <class _Tp, class _Up>
+inline const bool __desugars_to_v<__bit_or_tag, bit_or<void>, _Tp, _Up> = true;
 #endif
 
 #if _LIBCPP_STD_VER >= 14
@@ -274,6 +286,9 @@ struct bit_xor : __binary_function<_Tp, _Tp, _Tp> {
 };
 _LIBCPP_CTAD_SUPPORTED_FOR_TYPE(bit_xor);
 
+template <class _Tp>
+inline const bool __desugars_to_v<__bit_xor_tag, bit_xor<_Tp>, _Tp, _Tp> = true;
+
 #if _LIBCPP_STD_VER >= 14
 template <>
 struct bit_xor<void> {
@@ -285,6 +300,9 @@ struct bit_xor<void> {
   }
   typedef void is_transparent;
 };
+
+template <class _Tp, class _Up>
+inline const bool __desugars_to_v<__bit_xor_tag, bit_xor<void>, _Tp, _Up> = true;
 #endif
 
 // Comparison operations
@@ -483,6 +501,9 @@ struct logical_and : __binary_function<_Tp, _Tp, bool> {
 };
 _LIBCPP_CTAD_SUPPORTED_FOR_TYPE(logical_and);
 
+template <class _Tp>
+inline const bool __desugars_to_v<__logical_and_tag, logical_and<_Tp>, _Tp, _Tp> = true;
+
 #if _LIBCPP_STD_VER >= 14
 template <>
 struct logical_and<void> {
@@ -494,6 +515,9 @@ struct logical_and<void> {
   }
   typedef void is_transparent;
 };
+
+template <class _Tp, class _Up>
+inline const bool __desugars_to_v<__logical_and_tag, logical_and<void>, _Tp, _Up> = true;
 #endif
 
 #if _LIBCPP_STD_VER >= 14
@@ -507,6 +531,9 @@ struct logical_not : __unary_function<_Tp, bool> {
 };
 _LIBCPP_CTAD_SUPPORTED_FOR_TYPE(logical_not);
 
+template <class _Tp>
+inline const bool __desugars_to_v<__logical_not_tag, logical_not<_Tp>, _Tp> = true;
+
 #if _LIBCPP_STD_VER >= 14
 template <>
 struct logical_not<void> {
@@ -518,6 +545,9 @@ struct logical_not<void> {
   }
   typedef void is_transparent;
 };
+
+template <class _Tp>
+inline const bool __desugars_to_v<__logical_not_tag, logical_not<void>, _Tp> = true;
 #endif
 
 #if _LIBCPP_STD_VER >= 14
@@ -533,6 +563,9 @@ struct logical_or : __binary_function<_Tp, _Tp, bool> {
 };
 _LIBCPP_CTAD_SUPPORTED_FOR_TYPE(logical_or);
 
+template <class _Tp>
+inline const bool __desugars_to_v<__logical_or_tag, logical_or<_Tp>, _Tp, _Tp> = true;
+
 #if _LIBCPP_STD_VER >= 14
 template <>
 struct logical_or<void> {
@@ -544,6 +577,9 @@ struct logical_or<void> {
   }
   typedef void is_transparent;
 };
+
+template <class _Tp, class _Up>
+inline const bool __desugars_to_v<__logical_or_tag, logical_or<void>, _Tp, _Up> = true;
 #endif
 
 _LIBCPP_END_NAMESPACE_STD
@@ -18,6 +18,8 @@
 #define _LIBCPP___MDSPAN_LAYOUTS_H
 
 #include <__config>
+#include <__cstddef/size_t.h>
+#include <__fwd/span.h>
 
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
@@ -48,6 +50,41 @@ struct layout_stride {
   class mapping;
 };
 
+#  if _LIBCPP_STD_VER >= 26
+
+// Layout policy with a mapping which corresponds to FORTRAN-style array layouts whose leftmost extent is padded
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_left_padded {
+  template <class _Extents>
+  class mapping;
+};
+
+// Layout policy with a mapping which corresponds to C-style array layouts whose rightmost extent is padded
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_right_padded {
+  template <class _Extents>
+  class mapping;
+};
+
+#    if _LIBCPP_HAS_EXPERIMENTAL_MDSPAN_TILING
+// Layout policy with a mapping which stores the elements tile by tile, where the tiles have the static extents
+// _TileExtents. The tiles and the elements within a tile are laid out like C-style arrays.
+template <class _TileExtents>
+struct layout_blocked {
+  template <class _Extents>
+  class mapping;
+};
+#    endif
+
+namespace __mdspan_detail {
+// Implementation of the submdspan_mapping customization point of the standard layouts, see
+// <__mdspan/submdspan_mapping.h>
+template <class _Mapping, class... _SliceSpecifiers>
+_LIBCPP_HIDE_FROM_ABI constexpr auto __submdspan_mapping(const _Mapping& __src, _SliceSpecifiers... __slices);
+} // namespace __mdspan_detail
+
+#  endif // _LIBCPP_STD_VER >= 26
+
 #endif // _LIBCPP_STD_VER >= 23
 
 _LIBCPP_END_NAMESPACE_STD
@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_H
+#define _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_H
+
+#include <__assert>
+#include <__atomic/atomic.h>
+#include <__atomic/memory_order.h>
+#include <__config>
+#include <__cstddef/nullptr_t.h>
+#include <__hazard_pointer/hazard_pointer_domain.h>
+#include <__memory/addressof.h>
+#include <__utility/exchange.h>
+#include <__utility/swap.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_HAZARD_POINTER
+
+class hazard_pointer;
+
+_LIBCPP_HIDE_FROM_ABI hazard_pointer make_hazard_pointer();
+
+class hazard_pointer {
+  __hazard_pointer_record* __rec_;
+
+  _LIBCPP_HIDE_FROM_ABI explicit hazard_pointer(__hazard_pointer_record* __rec) _NOEXCEPT : __rec_(__rec) {}
+
+  friend hazard_pointer make_hazard_pointer();
+
+public:
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer() _NOEXCEPT : __rec_(nullptr) {}
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer(hazard_pointer&& __other) _NOEXCEPT
+      : __rec_(std::exchange(__other.__rec_, nullptr)) {}
+
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer& operator=(hazard_pointer&& __other) _NOEXCEPT {
+    if (this != std::addressof(__other)) {
+      if (__rec_ != nullptr)
+        __hazard_pointer_domain::__instance().__release_record(__rec_);
+      __rec_ = std::exchange(__other.__rec_, nullptr);
+    }
+    return *this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI ~hazard_pointer() {
+    if (__rec_ != nullptr)
+      __hazard_pointer_domain::__instance().__release_record(__rec_);
+  }
+
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI bool empty() const _NOEXCEPT { return __rec_ == nullptr; }
+
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI _Tp* protect(const atomic<_Tp*>& __src) _NOEXCEPT {
+    _Tp* __ptr = __src.load(memory_order_relaxed);
+    while (!try_protect(__ptr, __src)) {
+    }
+    return __ptr;
+  }
+
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI bool try_protect(_Tp*& __ptr, const atomic<_Tp*>& __src) _NOEXCEPT {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(!empty(), "hazard_pointer::try_protect called on an empty hazard_pointer");
+    _Tp* __old = __ptr;
+    reset_protection(__old);
+    // Pairs with the fence in the scan of the domain, see there.
+    std::atomic_thread_fence(memory_order_seq_cst);
+    __ptr = __src.load(memory_order_acquire);
+    if (__ptr != __old) {
+      reset_protection();
+      return false;
+    }
+    return true;
+  }
+
+  template <class _Tp>
+  _LIBCPP_HIDE_FROM_ABI void reset_protection(const _Tp* __ptr) _NOEXCEPT {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(!empty(), "hazard_pointer::reset_protection called on an empty hazard_pointer");
+    __rec_->__ptr_.store(__ptr, memory_order_release);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void reset_protection(nullptr_t = nullptr) _NOEXCEPT {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(!empty(), "hazard_pointer::reset_protection called on an empty hazard_pointer");
+    __rec_->__ptr_.store(nullptr, memory_order_release);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void swap(hazard_pointer& __other) _NOEXCEPT { std::swap(__rec_, __other.__rec_); }
+};
+
+// Hazard pointer slots are recycled, so this only allocates when every slot
+// handed out so far is still owned by a hazard_pointer.
+_LIBCPP_HIDE_FROM_ABI inline hazard_pointer make_hazard_pointer() {
+  return hazard_pointer(__hazard_pointer_domain::__instance().__acquire_record());
+}
+
+_LIBCPP_HIDE_FROM_ABI inline void swap(hazard_pointer& __a, hazard_pointer& __b) _NOEXCEPT { __a.swap(__b); }
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_HAZARD_POINTER
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_H
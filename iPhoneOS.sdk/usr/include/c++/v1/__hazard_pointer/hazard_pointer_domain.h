@@ -0,0 +1,214 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_DOMAIN_H
+#define _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_DOMAIN_H
+
+#include <__algorithm/binary_search.h>
+#include <__algorithm/sort.h>
+#include <__atomic/atomic.h>
+#include <__atomic/memory_order.h>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__new/allocate.h>
+#include <__new/nothrow_t.h>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_HAZARD_POINTER
+
+// A hazard pointer slot. Slots are owned by one hazard_pointer at a time and
+// are recycled rather than freed, so scanning them never races with their
+// destruction.
+struct __hazard_pointer_record {
+  atomic<const void*> __ptr_;
+  atomic<bool> __in_use_;
+  __hazard_pointer_record* __next_;
+
+  _LIBCPP_HIDE_FROM_ABI __hazard_pointer_record() _NOEXCEPT : __ptr_(nullptr), __in_use_(true), __next_(nullptr) {}
+};
+
+// The intrusive part of a retired object: the private base of hazard_pointer_obj_base.
+struct __hazard_pointer_node {
+  __hazard_pointer_node* __hp_next_;
+  void (*__hp_reclaim_)(__hazard_pointer_node*) _NOEXCEPT;
+  const void* __hp_ptr_;
+};
+
+// The default hazard pointer domain.
+//
+// Retired objects are kept on a list owned by the retiring thread. Once that
+// list grows beyond a threshold proportional to the number of hazard pointers,
+// the thread takes a snapshot of all the hazard pointers, sorts it, and
+// reclaims every object of its list that does not appear in the snapshot.
+// Each scan costs O(R log H) for R retired objects and H hazard pointers, and
+// frees at least R - H objects, so reclamation is amortized constant time per
+// retired object. Lists of exiting threads are handed over to the domain and
+// picked up by the next scan.
+class __hazard_pointer_domain {
+  static constexpr size_t __min_batch_size = 64;
+
+  struct __retired_list {
+    __hazard_pointer_domain& __dom_;
+    __hazard_pointer_node* __head_;
+    size_t __count_;
+
+    _LIBCPP_HIDE_FROM_ABI explicit __retired_list(__hazard_pointer_domain& __dom) _NOEXCEPT
+        : __dom_(__dom), __head_(nullptr), __count_(0) {}
+
+    _LIBCPP_HIDE_FROM_ABI ~__retired_list() {
+      while (__head_ != nullptr) {
+        __hazard_pointer_node* __next = __head_->__hp_next_;
+        __dom_.__push_orphan(__head_);
+        __head_ = __next;
+      }
+    }
+
+    _LIBCPP_HIDE_FROM_ABI void __push(__hazard_pointer_node* __node) _NOEXCEPT {
+      __node->__hp_next_ = __head_;
+      __head_            = __node;
+      ++__count_;
+    }
+
+    __retired_list(const __retired_list&)            = delete;
+    __retired_list& operator=(const __retired_list&) = delete;
+  };
+
+  atomic<__hazard_pointer_record*> __records_;
+  atomic<size_t> __record_count_;
+  atomic<__hazard_pointer_node*> __orphans_;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __hazard_pointer_domain() _NOEXCEPT
+      : __records_(nullptr), __record_count_(0), __orphans_(nullptr) {}
+
+  _LIBCPP_HIDE_FROM_ABI __retired_list& __this_list() _NOEXCEPT {
+    static thread_local __retired_list __list(*this);
+    return __list;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __push_orphan(__hazard_pointer_node* __node) _NOEXCEPT {
+    __hazard_pointer_node* __head = __orphans_.load(memory_order_relaxed);
+    do
+      __node->__hp_next_ = __head;
+    while (!__orphans_.compare_exchange_weak(__head, __node, memory_order_release, memory_order_relaxed));
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool __is_protected_linear(const void* __ptr) const _NOEXCEPT {
+    for (__hazard_pointer_record* __r = __records_.load(memory_order_acquire); __r != nullptr; __r = __r->__next_)
+      if (__r->__ptr_.load(memory_order_acquire) == __ptr)
+        return true;
+    return false;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __scan(__retired_list& __list) _NOEXCEPT {
+    __hazard_pointer_node* __batch = __list.__head_;
+    __list.__head_                 = nullptr;
+    __list.__count_                = 0;
+    for (__hazard_pointer_node* __orphans = __orphans_.exchange(nullptr, memory_order_acquire); __orphans != nullptr;) {
+      __hazard_pointer_node* __next = __orphans->__hp_next_;
+      __orphans->__hp_next_         = __batch;
+      __batch                       = __orphans;
+      __orphans                     = __next;
+    }
+
+    // Pairs with the fence in hazard_pointer::try_protect: either the reader
+    // sees that the object was unlinked, or this scan sees its hazard pointer.
+    std::atomic_thread_fence(memory_order_seq_cst);
+
+    // Records are only ever added, and __record_count_ is incremented before a
+    // record is published, so the snapshot can only overflow if records were
+    // added during the scan. Fall back to a linear search in that case, or if
+    // the snapshot cannot be allocated.
+    size_t __capacity    = __record_count_.load(memory_order_acquire);
+    uintptr_t* __hazards = new (nothrow) uintptr_t[__capacity];
+    size_t __size        = 0;
+    bool __use_snapshot  = __hazards != nullptr;
+    for (__hazard_pointer_record* __r = __records_.load(memory_order_acquire); __r != nullptr && __use_snapshot;
+         __r = __r->__next_) {
+      const void* __ptr = __r->__ptr_.load(memory_order_acquire);
+      if (__ptr == nullptr)
+        continue;
+      if (__size == __capacity)
+        __use_snapshot = false;
+      else
+        __hazards[__size++] = reinterpret_cast<uintptr_t>(__ptr);
+    }
+    if (__use_snapshot)
+      std::sort(__hazards, __hazards + __size);
+
+    while (__batch != nullptr) {
+      __hazard_pointer_node* __next = __batch->__hp_next_;
+      bool __protected =
+          __use_snapshot
+              ? std::binary_search(__hazards, __hazards + __size, reinterpret_cast<uintptr_t>(__batch->__hp_ptr_))
+              : __is_protected_linear(__batch->__hp_ptr_);
+      if (__protected)
+        __list.__push(__batch);
+      else
+        __batch->__hp_reclaim_(__batch);
+      __batch = __next;
+    }
+    delete[] __hazards;
+  }
+
+public:
+  __hazard_pointer_domain(const __hazard_pointer_domain&)            = delete;
+  __hazard_pointer_domain& operator=(const __hazard_pointer_domain&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI static __hazard_pointer_domain& __instance() _NOEXCEPT {
+    _LIBCPP_NO_DESTROY static __hazard_pointer_domain __result;
+    return __result;
+  }
+
+  // Hands out an unused record, or allocates a new one.
+  _LIBCPP_HIDE_FROM_ABI __hazard_pointer_record* __acquire_record() {
+    for (__hazard_pointer_record* __r = __records_.load(memory_order_acquire); __r != nullptr; __r = __r->__next_) {
+      bool __expected = false;
+      if (!__r->__in_use_.load(memory_order_relaxed) &&
+          __r->__in_use_.compare_exchange_strong(__expected, true, memory_order_acquire, memory_order_relaxed))
+        return __r;
+    }
+    __hazard_pointer_record* __r = new __hazard_pointer_record;
+    __record_count_.fetch_add(1, memory_order_relaxed);
+    __hazard_pointer_record* __head = __records_.load(memory_order_relaxed);
+    do
+      __r->__next_ = __head;
+    while (!__records_.compare_exchange_weak(__head, __r, memory_order_release, memory_order_relaxed));
+    return __r;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __release_record(__hazard_pointer_record* __r) _NOEXCEPT {
+    __r->__ptr_.store(nullptr, memory_order_release);
+    __r->__in_use_.store(false, memory_order_release);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __retire(__hazard_pointer_node* __node) _NOEXCEPT {
+    __retired_list& __list = __this_list();
+    __list.__push(__node);
+    size_t __threshold = 2 * __record_count_.load(memory_order_relaxed);
+    if (__list.__count_ >= (__threshold < __min_batch_size ? __min_batch_size : __threshold))
+      __scan(__list);
+  }
+};
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_HAZARD_POINTER
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_DOMAIN_H
@@ -0,0 +1,63 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_OBJ_BASE_H
+#define _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_OBJ_BASE_H
+
+#include <__config>
+#include <__hazard_pointer/hazard_pointer_domain.h>
+#include <__memory/unique_ptr.h>
+#include <__utility/move.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_HAZARD_POINTER
+
+template <class _Tp, class _Dp = default_delete<_Tp> >
+class hazard_pointer_obj_base : private __hazard_pointer_node {
+  _LIBCPP_NO_UNIQUE_ADDRESS _Dp __deleter_;
+
+  _LIBCPP_HIDE_FROM_ABI static void __reclaim(__hazard_pointer_node* __node) _NOEXCEPT {
+    hazard_pointer_obj_base* __self = static_cast<hazard_pointer_obj_base*>(__node);
+    _Dp __deleter                   = std::move(__self->__deleter_);
+    __deleter(static_cast<_Tp*>(__self));
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI void retire(_Dp __d = _Dp()) _NOEXCEPT {
+    __deleter_    = std::move(__d);
+    __hp_reclaim_ = &__reclaim;
+    // Hazard pointers hold the address of the complete object.
+    __hp_ptr_ = static_cast<const _Tp*>(this);
+    __hazard_pointer_domain::__instance().__retire(this);
+  }
+
+protected:
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer_obj_base()                                          = default;
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer_obj_base(const hazard_pointer_obj_base&)            = default;
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer_obj_base(hazard_pointer_obj_base&&)                 = default;
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer_obj_base& operator=(const hazard_pointer_obj_base&) = default;
+  _LIBCPP_HIDE_FROM_ABI hazard_pointer_obj_base& operator=(hazard_pointer_obj_base&&)      = default;
+  _LIBCPP_HIDE_FROM_ABI ~hazard_pointer_obj_base()                                         = default;
+};
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_HAZARD_POINTER
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___HAZARD_POINTER_HAZARD_POINTER_OBJ_BASE_H
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___ITERATOR_STRIDED_ITERATOR_H
+#define _LIBCPP___ITERATOR_STRIDED_ITERATOR_H
+
+// Strided iterators are iterators that step through a random access range by a
+// fixed number of elements at a time, such as the iterators of stride_view and
+// chunk_view.
+//
+// Each increment of such an iterator clamps the step to the end of the range.
+// Algorithms that know about strided iterators instead compute the number of
+// steps once and run an index loop over the underlying iterator.
+//
+// If __strided_iterator_traits can be instantiated, the following functions and associated types must be provided:
+// - Traits::__base_iterator
+//   The random access iterator of the underlying range.
+//
+// - Traits::difference_type
+//   The difference type of the strided iterator.
+//
+// - static __base_iterator Traits::__base(const It& __it)
+//   Returns the underlying iterator the provided iterator is at.
+//
+// - static difference_type Traits::__stride(const It& __it)
+//   Returns the number of underlying elements between two consecutive positions.
+//
+// - static difference_type Traits::__size(const It& __it)
+//   Returns the number of underlying elements from __base(__it) to the end of the range.
+//
+// - static decltype(auto) Traits::__element(__base_iterator __first, difference_type __offset,
+//                                           difference_type __stride, difference_type __size)
+//   Returns what dereferencing the iterator at __first + __offset produces, where __size is the number of underlying
+//   elements from __first to the end of the range.
+
+#include <__config>
+#include <__iterator/segmented_iterator.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+template <class _Iterator>
+struct __strided_iterator_traits;
+/* exposition-only:
+{
+  using __base_iterator = ...;
+  using difference_type = ...;
+
+  static __base_iterator __base(const _Iterator&);
+  static difference_type __stride(const _Iterator&);
+  static difference_type __size(const _Iterator&);
+  static decltype(auto) __element(__base_iterator, difference_type, difference_type, difference_type);
+};
+*/
+
+template <class _Iterator>
+using __is_strided_iterator _LIBCPP_NODEBUG = __has_specialization<__strided_iterator_traits<_Iterator> >;
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP___ITERATOR_STRIDED_ITERATOR_H
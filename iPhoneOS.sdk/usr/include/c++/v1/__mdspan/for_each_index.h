@@ -0,0 +1,164 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===---------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MDSPAN_FOR_EACH_INDEX_H
+#define _LIBCPP___MDSPAN_FOR_EACH_INDEX_H
+
+#include <__algorithm/min.h>
+#include <__assert>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__fwd/mdspan.h>
+#include <__mdspan/extents.h>
+#include <__mdspan/layout_blocked.h>
+#include <__mdspan/layout_left.h>
+#include <__mdspan/layout_left_padded.h>
+#include <__mdspan/mdspan.h>
+#include <__type_traits/is_same.h>
+#include <__utility/integer_sequence.h>
+#include <array>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 26 && _LIBCPP_HAS_EXPERIMENTAL_MDSPAN_TILING
+
+namespace __mdspan_detail {
+// Visits __first <= __idx < __last in steps of __step, with the rightmost index running fastest, or the leftmost one
+// if _LeftFastest is true. The nesting is unrolled at compile time, so the innermost loop is a plain counted loop.
+template <bool _LeftFastest, size_t _Depth, class _IndexType, size_t _Rank, class _Func>
+_LIBCPP_HIDE_FROM_ABI constexpr void __for_each_index_in_box(
+    const array<_IndexType, _Rank>& __first,
+    const array<_IndexType, _Rank>& __last,
+    const array<_IndexType, _Rank>& __step,
+    array<_IndexType, _Rank>& __idx,
+    _Func& __func) {
+  if constexpr (_Depth == _Rank) {
+    __func(__idx);
+  } else {
+    constexpr size_t __r = _LeftFastest ? _Rank - 1 - _Depth : _Depth;
+    for (__idx[__r] = __first[__r]; __idx[__r] < __last[__r]; __idx[__r] += __step[__r])
+      __mdspan_detail::__for_each_index_in_box<_LeftFastest, _Depth + 1>(__first, __last, __step, __idx, __func);
+  }
+}
+
+template <bool _LeftFastest, class _IndexType, size_t _Rank, class _Func>
+_LIBCPP_HIDE_FROM_ABI constexpr void
+__for_each_index(const array<_IndexType, _Rank>& __first, const array<_IndexType, _Rank>& __last, _Func& __func) {
+  array<_IndexType, _Rank> __step;
+  __step.fill(1);
+  array<_IndexType, _Rank> __idx{};
+  auto __call = [&](const array<_IndexType, _Rank>& __i) {
+    [&]<size_t... _Pos>(index_sequence<_Pos...>) { __func(__i[_Pos]...); }(make_index_sequence<_Rank>());
+  };
+  __mdspan_detail::__for_each_index_in_box<_LeftFastest, 0>(__first, __last, __step, __idx, __call);
+}
+
+// Visits the index space tile by tile. Both the tiles and the indices within a tile are visited in the order
+// given by _LeftFastest. The tiles at the upper edges are clipped to the extents.
+template <bool _LeftFastest, class _IndexType, size_t _Rank, class _Func>
+_LIBCPP_HIDE_FROM_ABI constexpr void
+__for_each_index_tiled(const array<_IndexType, _Rank>& __ext, const array<_IndexType, _Rank>& __tile, _Func& __func) {
+  array<_IndexType, _Rank> __zero{};
+  array<_IndexType, _Rank> __origin{};
+  auto __visit_tile = [&](const array<_IndexType, _Rank>& __tile_first) {
+    array<_IndexType, _Rank> __tile_last;
+    for (size_t __r = 0; __r < _Rank; ++__r)
+      __tile_last[__r] = std::min<_IndexType>(__tile_first[__r] + __tile[__r], __ext[__r]);
+    __mdspan_detail::__for_each_index<_LeftFastest>(__tile_first, __tile_last, __func);
+  };
+  __mdspan_detail::__for_each_index_in_box<_LeftFastest, 0>(__zero, __ext, __tile, __origin, __visit_tile);
+}
+
+template <class _ToIndexType, class _IndexType, size_t... _Extents>
+_LIBCPP_HIDE_FROM_ABI constexpr array<_ToIndexType, sizeof...(_Extents)>
+__extents_to_array(const extents<_IndexType, _Extents...>& __ext) {
+  return [&]<size_t... _Pos>(index_sequence<_Pos...>) {
+    return array<_ToIndexType, sizeof...(_Extents)>{static_cast<_ToIndexType>(__ext.extent(_Pos))...};
+  }(make_index_sequence<sizeof...(_Extents)>());
+}
+
+template <class _Layout>
+inline constexpr bool __is_layout_blocked = false;
+
+template <class _TileExtents>
+inline constexpr bool __is_layout_blocked<layout_blocked<_TileExtents>> = true;
+
+template <class _Layout>
+inline constexpr bool __is_layout_left_padded = false;
+
+template <size_t _PaddingValue>
+inline constexpr bool __is_layout_left_padded<layout_left_padded<_PaddingValue>> = true;
+} // namespace __mdspan_detail
+
+// Calls __func(__i0, ..., __in) for every multidimensional index of __ext, with the rightmost index running fastest.
+template <class _IndexType, size_t... _Extents, class _Func>
+_LIBCPP_HIDE_FROM_ABI constexpr _Func for_each_index(const extents<_IndexType, _Extents...>& __ext, _Func __func) {
+  array<_IndexType, sizeof...(_Extents)> __first{};
+  __mdspan_detail::__for_each_index<false>(__first, __mdspan_detail::__extents_to_array<_IndexType>(__ext), __func);
+  return __func;
+}
+
+// Calls __func(__i0, ..., __in) for every multidimensional index of __ext, visiting the index space tile by tile,
+// with tiles of extents __tile. Both the tiles and the indices within a tile are visited with the rightmost index
+// running fastest.
+//
+// This keeps the working set of an operation that accesses several arrays with different layouts, like a
+// transpose, or that accesses neighbouring elements, like a stencil, in the cache.
+template <class _IndexType, size_t... _Extents, class _TileIndexType, size_t... _TileExtents, class _Func>
+  requires(sizeof...(_Extents) == sizeof...(_TileExtents))
+_LIBCPP_HIDE_FROM_ABI constexpr _Func for_each_index(const extents<_IndexType, _Extents...>& __ext,
+                                                     const extents<_TileIndexType, _TileExtents...>& __tile,
+                                                     _Func __func) {
+  _LIBCPP_ASSERT_ARGUMENT_WITHIN_DOMAIN(
+      ([&]<size_t... _Pos>(index_sequence<_Pos...>) {
+        return ((__tile.extent(_Pos) > 0) && ... && true);
+      }(make_index_sequence<sizeof...(_Extents)>())),
+      "for_each_index: the tile extents must be greater than 0");
+  __mdspan_detail::__for_each_index_tiled<false>(
+      __mdspan_detail::__extents_to_array<_IndexType>(__ext),
+      __mdspan_detail::__extents_to_array<_IndexType>(__tile),
+      __func);
+  return __func;
+}
+
+// Calls __func(__i0, ..., __in) for every multidimensional index of __m, in an order which follows the layout of __m
+// in memory: tile by tile for layout_blocked, with the leftmost index running fastest for layout_left and
+// layout_left_padded, and with the rightmost index running fastest otherwise.
+template <class _ElementType, class _Extents, class _LayoutPolicy, class _AccessorPolicy, class _Func>
+_LIBCPP_HIDE_FROM_ABI constexpr _Func
+for_each_index(const mdspan<_ElementType, _Extents, _LayoutPolicy, _AccessorPolicy>& __m, _Func __func) {
+  using _IndexType = typename _Extents::index_type;
+  auto __ext       = __mdspan_detail::__extents_to_array<_IndexType>(__m.extents());
+  if constexpr (__mdspan_detail::__is_layout_blocked<_LayoutPolicy>) {
+    using _TileExtents = typename _LayoutPolicy::template mapping<_Extents>::tile_extents_type;
+    __mdspan_detail::__for_each_index_tiled<false>(
+        __ext, __mdspan_detail::__extents_to_array<_IndexType>(_TileExtents()), __func);
+  } else {
+    constexpr bool __left_fastest =
+        is_same_v<_LayoutPolicy, layout_left> || __mdspan_detail::__is_layout_left_padded<_LayoutPolicy>;
+    decltype(__ext) __first{};
+    __mdspan_detail::__for_each_index<__left_fastest>(__first, __ext, __func);
+  }
+  return __func;
+}
+
+#endif // _LIBCPP_STD_VER >= 26 && _LIBCPP_HAS_EXPERIMENTAL_MDSPAN_TILING
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MDSPAN_FOR_EACH_INDEX_H
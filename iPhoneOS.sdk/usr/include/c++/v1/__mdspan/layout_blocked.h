@@ -0,0 +1,222 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===---------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MDSPAN_LAYOUT_BLOCKED_H
+#define _LIBCPP___MDSPAN_LAYOUT_BLOCKED_H
+
+#include <__assert>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__fwd/mdspan.h>
+#include <__mdspan/extents.h>
+#include <__memory/addressof.h>
+#include <__type_traits/is_constructible.h>
+#include <__type_traits/is_convertible.h>
+#include <__type_traits/is_nothrow_constructible.h>
+#include <__utility/div_ceil.h>
+#include <__utility/integer_sequence.h>
+#include <array>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 26 && _LIBCPP_HAS_EXPERIMENTAL_MDSPAN_TILING
+
+// The elements are stored tile by tile. Both the tiles in the grid of tiles and the elements in a tile are laid out
+// like layout_right, so the element at (i0, ..., in) is at
+//
+//   tile_index(i0 / t0, ..., in / tn) * tile_size + index_in_tile(i0 % t0, ..., in % tn)
+//
+// The tiles at the upper edges of the extents are padded to full tiles. The tile extents are static, so the
+// divisions are by constants, and for power-of-two tiles they are shifts and masks.
+template <class _TileExtents>
+template <class _Extents>
+class layout_blocked<_TileExtents>::mapping {
+public:
+  static_assert(__mdspan_detail::__is_extents<_Extents>::value,
+                "layout_blocked::mapping template argument must be a specialization of extents.");
+  static_assert(__mdspan_detail::__is_extents<_TileExtents>::value,
+                "layout_blocked template argument must be a specialization of extents.");
+  static_assert(_TileExtents::rank_dynamic() == 0, "layout_blocked tile extents must be static.");
+  static_assert(_TileExtents::rank() == _Extents::rank(),
+                "layout_blocked::mapping rank of the extents must be equal to the rank of the tile extents.");
+
+  using extents_type      = _Extents;
+  using index_type        = typename extents_type::index_type;
+  using size_type         = typename extents_type::size_type;
+  using rank_type         = typename extents_type::rank_type;
+  using layout_type       = layout_blocked<_TileExtents>;
+  using tile_extents_type = _TileExtents;
+
+private:
+  static constexpr rank_type __rank_ = extents_type::rank();
+
+  template <rank_type _Rp>
+  static constexpr index_type __tile_extent_ = static_cast<index_type>(tile_extents_type::static_extent(_Rp));
+
+  static constexpr size_t __static_tile_size_ = [] {
+    size_t __size = 1;
+    for (rank_type __r = 0; __r < __rank_; __r++)
+      __size *= tile_extents_type::static_extent(__r);
+    return __size;
+  }();
+
+  static_assert(__static_tile_size_ != 0, "layout_blocked tile extents must be greater than 0.");
+  static_assert(__mdspan_detail::__is_representable_as<index_type>(__static_tile_size_),
+                "layout_blocked::mapping product of the tile extents must be representable as index_type.");
+
+  static constexpr index_type __tile_size_ = static_cast<index_type>(__static_tile_size_);
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr index_type __tile_extent(rank_type __r) noexcept {
+    return static_cast<index_type>(tile_extents_type::static_extent(__r));
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool __required_span_size_is_representable(const extents_type& __ext) {
+    index_type __prod = __tile_size_;
+    for (rank_type __r = 0; __r < __rank_; __r++) {
+      bool __overflowed = __builtin_mul_overflow(
+          __prod, std::__div_ceil(__ext.extent(__r), __tile_extent(__r)), std::addressof(__prod));
+      if (__overflowed)
+        return false;
+    }
+    return true;
+  }
+
+  static_assert(extents_type::rank_dynamic() > 0 || __required_span_size_is_representable(extents_type()),
+                "layout_blocked::mapping required span size of static extents must be representable as index_type.");
+
+  // The number of tiles along dimension __r
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type __tile_count(rank_type __r) const noexcept {
+    return std::__div_ceil(__extents_.extent(__r), __tile_extent(__r));
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping() noexcept               = default;
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping(const mapping&) noexcept = default;
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping(const extents_type& __ext) noexcept : __extents_(__ext) {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __required_span_size_is_representable(__ext),
+        "layout_blocked::mapping extents ctor: required span size must be representable as index_type.");
+  }
+
+  template <class _OtherExtents>
+    requires(is_constructible_v<extents_type, _OtherExtents>)
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit(!is_convertible_v<_OtherExtents, extents_type>)
+      mapping(const mapping<_OtherExtents>& __other) noexcept
+      : __extents_(__other.extents()) {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__other.required_span_size()),
+        "layout_blocked::mapping converting ctor: other.required_span_size() must be representable as index_type.");
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping& operator=(const mapping&) noexcept = default;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr const extents_type& extents() const noexcept { return __extents_; }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type required_span_size() const noexcept {
+    index_type __size = __tile_size_;
+    for (rank_type __r = 0; __r < __rank_; __r++)
+      __size *= __tile_count(__r);
+    return __size;
+  }
+
+  template <class... _Indices>
+    requires((sizeof...(_Indices) == __rank_) && (is_convertible_v<_Indices, index_type> && ...) &&
+             (is_nothrow_constructible_v<index_type, _Indices> && ...))
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type operator()(_Indices... __idx) const noexcept {
+    _LIBCPP_ASSERT_UNCATEGORIZED(__mdspan_detail::__is_multidimensional_index_in(__extents_, __idx...),
+                                 "layout_blocked::mapping: out of bounds indexing");
+    array<index_type, __rank_> __idx_a{static_cast<index_type>(__idx)...};
+    return [&]<size_t... _Pos>(index_sequence<_Pos...>) {
+      index_type __tile    = 0;
+      index_type __in_tile = 0;
+      ((__tile    = __tile * __tile_count(_Pos) + __idx_a[_Pos] / __tile_extent_<_Pos>,
+        __in_tile = __in_tile * __tile_extent_<_Pos> + __idx_a[_Pos] % __tile_extent_<_Pos>),
+       ...);
+      return __tile * __tile_size_ + __in_tile;
+    }(make_index_sequence<__rank_>());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_always_unique() noexcept { return true; }
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_always_exhaustive() noexcept {
+    for (rank_type __r = 0; __r < __rank_; __r++)
+      if (extents_type::static_extent(__r) == dynamic_extent ||
+          extents_type::static_extent(__r) % tile_extents_type::static_extent(__r) != 0)
+        return false;
+    return true;
+  }
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_always_strided() noexcept {
+    for (rank_type __r = 0; __r < __rank_; __r++)
+      if (tile_extents_type::static_extent(__r) != 1 &&
+          extents_type::static_extent(__r) > tile_extents_type::static_extent(__r))
+        return false;
+    return true;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_unique() noexcept { return true; }
+  _LIBCPP_HIDE_FROM_ABI constexpr bool is_exhaustive() const noexcept {
+    bool __divisible = true;
+    for (rank_type __r = 0; __r < __rank_; __r++) {
+      if (__extents_.extent(__r) == 0)
+        return true;
+      if (__extents_.extent(__r) % __tile_extent(__r) != 0)
+        __divisible = false;
+    }
+    return __divisible;
+  }
+  // The mapping is strided if no dimension has both more than one tile and more than one element per tile.
+  _LIBCPP_HIDE_FROM_ABI constexpr bool is_strided() const noexcept {
+    for (rank_type __r = 0; __r < __rank_; __r++)
+      if (__tile_extent(__r) != 1 && __extents_.extent(__r) > __tile_extent(__r))
+        return false;
+    return true;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type stride(rank_type __r) const noexcept
+    requires(extents_type::rank() > 0)
+  {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(__r < __rank_, "layout_blocked::mapping::stride(): invalid rank index");
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(is_strided(), "layout_blocked::mapping::stride(): the mapping is not strided");
+    index_type __s = 1;
+    if (__tile_count(__r) > 1) {
+      // The tiles are single elements along __r, so __r steps through the grid of tiles.
+      __s = __tile_size_;
+      for (rank_type __i = __r + 1; __i < __rank_; __i++)
+        __s *= __tile_count(__i);
+    } else {
+      for (rank_type __i = __r + 1; __i < __rank_; __i++)
+        __s *= __tile_extent(__i);
+    }
+    return __s;
+  }
+
+  template <class _OtherExtents>
+    requires(_OtherExtents::rank() == extents_type::rank())
+  _LIBCPP_HIDE_FROM_ABI friend constexpr bool
+  operator==(const mapping& __lhs, const mapping<_OtherExtents>& __rhs) noexcept {
+    return __lhs.extents() == __rhs.extents();
+  }
+
+private:
+  _LIBCPP_NO_UNIQUE_ADDRESS extents_type __extents_{};
+};
+
+#endif // _LIBCPP_STD_VER >= 26 && _LIBCPP_HAS_EXPERIMENTAL_MDSPAN_TILING
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MDSPAN_LAYOUT_BLOCKED_H
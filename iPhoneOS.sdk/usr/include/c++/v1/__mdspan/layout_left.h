@@ -21,6 +21,7 @@
 #include <__config>
 #include <__fwd/mdspan.h>
 #include <__mdspan/extents.h>
+#include <__mdspan/layout_stride.h>
 #include <__memory/addressof.h>
 #include <__type_traits/common_type.h>
 #include <__type_traits/is_constructible.h>
@@ -131,6 +132,33 @@ public:
     }
   }
 
+#  if _LIBCPP_STD_VER >= 26
+  template <class _LayoutLeftPaddedMapping>
+    requires(__mdspan_detail::__is_layout_left_padded_mapping_of<_LayoutLeftPaddedMapping> &&
+             is_constructible_v<extents_type, typename _LayoutLeftPaddedMapping::extents_type>)
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit(
+      !is_convertible_v<typename _LayoutLeftPaddedMapping::extents_type, extents_type>)
+      mapping(const _LayoutLeftPaddedMapping& __other) noexcept
+      : __extents_(__other.extents()) {
+    using _OtherExtents              = typename _LayoutLeftPaddedMapping::extents_type;
+    constexpr size_t __padding_value = _LayoutLeftPaddedMapping::padding_value;
+    constexpr size_t __padded_rank   = 0;
+    constexpr size_t __padded_static = _OtherExtents::rank() > 1 ? _OtherExtents::static_extent(__padded_rank) : 0;
+    static_assert(_OtherExtents::rank() <= 1 || __padding_value == dynamic_extent ||
+                      __padded_static == dynamic_extent || __padded_static % __padding_value == 0,
+                  "layout_left::mapping from layout_left_padded ctor: the padded extent must not need padding.");
+    if constexpr (extents_type::rank() > 1) {
+      _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+          __other.stride(1) == __other.extents().extent(__padded_rank),
+          "layout_left::mapping from layout_left_padded ctor: the padded extent must not be padded.");
+    }
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__other.required_span_size()),
+        "layout_left::mapping from layout_left_padded ctor: other.required_span_size() must be representable as "
+        "index_type.");
+  }
+#  endif
+
   _LIBCPP_HIDE_FROM_ABI constexpr mapping& operator=(const mapping&) noexcept = default;
 
   // [mdspan.layout.left.obs], observers
@@ -190,6 +218,14 @@ public:
     return __lhs.extents() == __rhs.extents();
   }
 
+#  if _LIBCPP_STD_VER >= 26
+  // [mdspan.sub.map], submdspan mapping specialization
+  template <class... _SliceSpecifiers>
+  _LIBCPP_HIDE_FROM_ABI friend constexpr auto submdspan_mapping(const mapping& __src, _SliceSpecifiers... __slices) {
+    return __mdspan_detail::__submdspan_mapping(__src, __slices...);
+  }
+#  endif
+
 private:
   _LIBCPP_NO_UNIQUE_ADDRESS extents_type __extents_{};
 };
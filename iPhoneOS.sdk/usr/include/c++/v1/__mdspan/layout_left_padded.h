@@ -0,0 +1,354 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===---------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MDSPAN_LAYOUT_LEFT_PADDED_H
+#define _LIBCPP___MDSPAN_LAYOUT_LEFT_PADDED_H
+
+#include <__assert>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__fwd/mdspan.h>
+#include <__mdspan/extents.h>
+#include <__mdspan/layout_stride.h>
+#include <__memory/addressof.h>
+#include <__type_traits/common_type.h>
+#include <__type_traits/conditional.h>
+#include <__type_traits/is_constructible.h>
+#include <__type_traits/is_convertible.h>
+#include <__type_traits/is_nothrow_constructible.h>
+#include <__utility/div_ceil.h>
+#include <__utility/integer_sequence.h>
+#include <array>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 26
+
+namespace __mdspan_detail {
+// LEAST-MULTIPLE-AT-LEAST in [mdspan.layout.leftpad.expo] and [mdspan.layout.rightpad.expo]
+template <class _Tp>
+_LIBCPP_HIDE_FROM_ABI constexpr _Tp __least_multiple_at_least(_Tp __x, _Tp __y) {
+  return __x == 0 ? __y : __x * std::__div_ceil(__y, __x);
+}
+
+// The static stride of the padded dimension of a padded layout, or dynamic_extent if it is not known statically.
+template <size_t _PaddingValue, size_t _StaticExtent>
+inline constexpr size_t __static_padding_stride =
+    _PaddingValue == dynamic_extent || _StaticExtent == dynamic_extent
+        ? dynamic_extent
+        : __mdspan_detail::__least_multiple_at_least(_PaddingValue, _StaticExtent);
+} // namespace __mdspan_detail
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_left_padded<_PaddingValue>::mapping {
+public:
+  static_assert(__mdspan_detail::__is_extents<_Extents>::value,
+                "layout_left_padded::mapping template argument must be a specialization of extents.");
+
+  static constexpr size_t padding_value = _PaddingValue;
+
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_left_padded<padding_value>;
+
+private:
+  static constexpr rank_type __rank_ = extents_type::rank();
+
+  static_assert(padding_value == dynamic_extent || __mdspan_detail::__is_representable_as<index_type>(padding_value),
+                "layout_left_padded::mapping padding_value must be representable as index_type.");
+
+  // The stride of the second dimension is the extent of the first dimension rounded up to a multiple of the
+  // padding. It is only stored if it is not known statically.
+  static constexpr size_t __static_padded_extent = __rank_ == 0 ? dynamic_extent : extents_type::static_extent(0);
+  static constexpr size_t __static_padding_stride =
+      __rank_ <= 1 ? 0 : __mdspan_detail::__static_padding_stride<padding_value, __static_padded_extent>;
+  struct __static_padding_stride_tag {};
+  using __padding_stride_type _LIBCPP_NODEBUG =
+      conditional_t<__static_padding_stride == dynamic_extent, index_type, __static_padding_stride_tag>;
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool __required_span_size_is_representable(const extents_type& __ext) {
+    if constexpr (__rank_ == 0)
+      return true;
+
+    // The extent of the first dimension is rounded up to the padding
+    index_type __prod = __ext.extent(0);
+    if constexpr (__rank_ > 1 && padding_value != dynamic_extent && padding_value != 0) {
+      index_type __padding = static_cast<index_type>(padding_value);
+      bool __overflowed =
+          __builtin_mul_overflow(__padding, std::__div_ceil(__prod, __padding), std::addressof(__prod));
+      if (__overflowed)
+        return false;
+    }
+    for (rank_type __r = 1; __r < __rank_; __r++) {
+      bool __overflowed = __builtin_mul_overflow(__prod, __ext.extent(__r), std::addressof(__prod));
+      if (__overflowed)
+        return false;
+    }
+    return true;
+  }
+
+  static_assert(extents_type::rank_dynamic() > 0 || __required_span_size_is_representable(extents_type()),
+                "layout_left_padded::mapping product of static extents and padding must be representable as "
+                "index_type.");
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr __padding_stride_type
+  __make_padding_stride([[maybe_unused]] index_type __stride) noexcept {
+    if constexpr (__static_padding_stride == dynamic_extent) {
+      return __stride;
+    } else {
+      _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+          __rank_ <= 1 || __stride == static_cast<index_type>(__static_padding_stride),
+          "layout_left_padded::mapping: the padded stride must be equal to its static value.");
+      return __padding_stride_type();
+    }
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr index_type
+  __padded_extent(const extents_type& __ext, [[maybe_unused]] index_type __padding) noexcept {
+    if constexpr (__rank_ <= 1)
+      return 0;
+    else
+      return __mdspan_detail::__least_multiple_at_least(__padding, __ext.extent(0));
+  }
+
+public:
+  // [mdspan.layout.leftpad.cons], constructors
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping() noexcept : mapping(extents_type()) {}
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping(const mapping&) noexcept = default;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping(const extents_type& __ext)
+      : __padding_stride_(__make_padding_stride(
+            padding_value == dynamic_extent
+                ? (__rank_ <= 1 ? 0 : __ext.extent(0))
+                : __padded_extent(__ext, static_cast<index_type>(padding_value)))),
+        __extents_(__ext) {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __required_span_size_is_representable(__ext),
+        "layout_left_padded::mapping extents ctor: required span size must be representable as index_type.");
+  }
+
+  template <class _OtherIndexType>
+    requires(is_convertible_v<_OtherIndexType, index_type> && is_nothrow_constructible_v<index_type, _OtherIndexType>)
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping(const extents_type& __ext, _OtherIndexType __padding)
+      : __padding_stride_(__make_padding_stride(__padded_extent(__ext, static_cast<index_type>(__padding)))),
+        __extents_(__ext) {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__padding) && static_cast<index_type>(__padding) > 0,
+        "layout_left_padded::mapping padding ctor: padding must be a positive value representable as index_type.");
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        padding_value == dynamic_extent || static_cast<index_type>(padding_value) == static_cast<index_type>(__padding),
+        "layout_left_padded::mapping padding ctor: padding must be equal to padding_value.");
+  }
+
+  template <class _OtherExtents>
+    requires(is_constructible_v<extents_type, _OtherExtents>)
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit(!is_convertible_v<_OtherExtents, extents_type>)
+      mapping(const layout_left::mapping<_OtherExtents>& __other)
+      : __padding_stride_(__make_padding_stride(__rank_ <= 1 ? 0 : __other.extents().extent(0))),
+        __extents_(__other.extents()) {
+    static_assert(_OtherExtents::rank() <= 1 || __static_padding_stride == dynamic_extent ||
+                      _OtherExtents::static_extent(0) == dynamic_extent ||
+                      __static_padding_stride == _OtherExtents::static_extent(0),
+                  "layout_left_padded::mapping from layout_left ctor: the first extent must not need padding.");
+    if constexpr (__rank_ > 1 && padding_value != dynamic_extent) {
+      _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+          __other.extents().extent(0) % static_cast<index_type>(padding_value) == 0,
+          "layout_left_padded::mapping from layout_left ctor: the first extent must be a multiple of padding_value.");
+    }
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__other.required_span_size()),
+        "layout_left_padded::mapping from layout_left ctor: other.required_span_size() must be representable as "
+        "index_type.");
+  }
+
+  template <class _OtherExtents>
+    requires(is_constructible_v<extents_type, _OtherExtents>)
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit(__rank_ > 0) mapping(const layout_stride::mapping<_OtherExtents>& __other)
+      : __padding_stride_(__make_padding_stride(__rank_ <= 1 ? 0 : __other.stride(1))),
+        __extents_(__other.extents()) {
+    if constexpr (__rank_ > 0) {
+      _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+          ([&]() {
+            using _CommonType = common_type_t<index_type, typename _OtherExtents::index_type>;
+            for (rank_type __r = 0; __r < __rank_; __r++)
+              if (static_cast<_CommonType>(stride(__r)) != static_cast<_CommonType>(__other.stride(__r)))
+                return false;
+            return true;
+          }()),
+          "layout_left_padded::mapping from layout_stride ctor: strides are not compatible with layout_left_padded.");
+    }
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__other.required_span_size()),
+        "layout_left_padded::mapping from layout_stride ctor: other.required_span_size() must be representable as "
+        "index_type.");
+  }
+
+  template <class _LayoutLeftPaddedMapping>
+    requires(__mdspan_detail::__is_layout_left_padded_mapping_of<_LayoutLeftPaddedMapping> &&
+             is_constructible_v<extents_type, typename _LayoutLeftPaddedMapping::extents_type>)
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit(
+      __rank_ > 1 && (padding_value != dynamic_extent || _LayoutLeftPaddedMapping::padding_value == dynamic_extent))
+      mapping(const _LayoutLeftPaddedMapping& __other)
+      : __padding_stride_(__make_padding_stride(__rank_ <= 1 ? 0 : __other.stride(1))),
+        __extents_(__other.extents()) {
+    static_assert(__rank_ <= 1 || padding_value == dynamic_extent ||
+                      _LayoutLeftPaddedMapping::padding_value == dynamic_extent ||
+                      padding_value == _LayoutLeftPaddedMapping::padding_value,
+                  "layout_left_padded::mapping converting ctor: the paddings must be equal.");
+    if constexpr (__rank_ > 1 && padding_value != dynamic_extent) {
+      _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+          __other.stride(1) == __padded_extent(__extents_, static_cast<index_type>(padding_value)),
+          "layout_left_padded::mapping converting ctor: the stride of other is not compatible with padding_value.");
+    }
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__other.required_span_size()),
+        "layout_left_padded::mapping converting ctor: other.required_span_size() must be representable as "
+        "index_type.");
+  }
+
+  template <class _LayoutRightPaddedMapping>
+    requires(__mdspan_detail::__is_layout_right_padded_mapping_of<_LayoutRightPaddedMapping> && __rank_ <= 1 &&
+             is_constructible_v<extents_type, typename _LayoutRightPaddedMapping::extents_type>)
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit(
+      !is_convertible_v<typename _LayoutRightPaddedMapping::extents_type, extents_type>)
+      mapping(const _LayoutRightPaddedMapping& __other) noexcept
+      : __extents_(__other.extents()) {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+        __mdspan_detail::__is_representable_as<index_type>(__other.required_span_size()),
+        "layout_left_padded::mapping converting ctor: other.required_span_size() must be representable as "
+        "index_type.");
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping& operator=(const mapping&) noexcept = default;
+
+  // [mdspan.layout.leftpad.obs], observers
+  _LIBCPP_HIDE_FROM_ABI constexpr const extents_type& extents() const noexcept { return __extents_; }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr array<index_type, __rank_> strides() const noexcept {
+    return [&]<size_t... _Pos>(index_sequence<_Pos...>) {
+      return array<index_type, __rank_>{stride(_Pos)...};
+    }(make_index_sequence<__rank_>());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type required_span_size() const noexcept {
+    if constexpr (__rank_ == 0) {
+      return 1;
+    } else {
+      index_type __prod = 1;
+      for (rank_type __r = 1; __r < __rank_; __r++)
+        __prod *= __extents_.extent(__r);
+      if (__prod == 0 || __extents_.extent(0) == 0)
+        return 0;
+      // The largest offset is stride(1) * (__prod - 1) + extent(0) - 1
+      if constexpr (__rank_ == 1)
+        return __extents_.extent(0);
+      else
+        return __padding_stride() * (__prod - 1) + __extents_.extent(0);
+    }
+  }
+
+  template <class... _Indices>
+    requires((sizeof...(_Indices) == __rank_) && (is_convertible_v<_Indices, index_type> && ...) &&
+             (is_nothrow_constructible_v<index_type, _Indices> && ...))
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type operator()(_Indices... __idx) const noexcept {
+    _LIBCPP_ASSERT_UNCATEGORIZED(__mdspan_detail::__is_multidimensional_index_in(__extents_, __idx...),
+                                 "layout_left_padded::mapping: out of bounds indexing");
+    if constexpr (__rank_ == 0) {
+      return 0;
+    } else {
+      // Same as layout_left, except that the first dimension steps by the padded stride.
+      array<index_type, __rank_> __idx_a{static_cast<index_type>(__idx)...};
+      index_type __res = __idx_a[__rank_ - 1];
+      for (rank_type __r = __rank_ - 1; __r-- > 1;)
+        __res = __idx_a[__r] + __extents_.extent(__r) * __res;
+      if constexpr (__rank_ > 1)
+        __res = __idx_a[0] + __padding_stride() * __res;
+      return __res;
+    }
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_always_unique() noexcept { return true; }
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_always_exhaustive() noexcept {
+    return __rank_ <= 1 ||
+           (__static_padding_stride != dynamic_extent && __static_padding_stride == __static_padded_extent);
+  }
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_always_strided() noexcept { return true; }
+
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_unique() noexcept { return true; }
+  _LIBCPP_HIDE_FROM_ABI constexpr bool is_exhaustive() const noexcept {
+    if constexpr (__rank_ <= 1)
+      return true;
+    else
+      return __padding_stride() == __extents_.extent(0);
+  }
+  _LIBCPP_HIDE_FROM_ABI static constexpr bool is_strided() noexcept { return true; }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type stride(rank_type __r) const noexcept {
+    _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(__r < __rank_, "layout_left_padded::mapping::stride(): invalid rank index");
+    if constexpr (__rank_ <= 1) {
+      return 1;
+    } else {
+      if (__r == 0)
+        return 1;
+      index_type __s = __padding_stride();
+      for (rank_type __i = 1; __i < __r; __i++)
+        __s *= __extents_.extent(__i);
+      return __s;
+    }
+  }
+
+  template <class _LayoutLeftPaddedMapping>
+    requires(__mdspan_detail::__is_layout_left_padded_mapping_of<_LayoutLeftPaddedMapping> &&
+             _LayoutLeftPaddedMapping::extents_type::rank() == __rank_)
+  _LIBCPP_HIDE_FROM_ABI friend constexpr bool
+  operator==(const mapping& __lhs, const _LayoutLeftPaddedMapping& __rhs) noexcept {
+    if constexpr (__rank_ <= 1) {
+      return __lhs.extents() == __rhs.extents();
+    } else {
+      using _CommonType = common_type_t<index_type, typename _LayoutLeftPaddedMapping::index_type>;
+      return __lhs.extents() == __rhs.extents() &&
+             static_cast<_CommonType>(__lhs.stride(1)) == static_cast<_CommonType>(__rhs.stride(1));
+    }
+  }
+
+  // [mdspan.sub.map], submdspan mapping specialization
+  template <class... _SliceSpecifiers>
+  _LIBCPP_HIDE_FROM_ABI friend constexpr auto submdspan_mapping(const mapping& __src, _SliceSpecifiers... __slices) {
+    return __mdspan_detail::__submdspan_mapping(__src, __slices...);
+  }
+
+private:
+  _LIBCPP_HIDE_FROM_ABI constexpr index_type __padding_stride() const noexcept {
+    if constexpr (__static_padding_stride == dynamic_extent)
+      return __padding_stride_;
+    else
+      return static_cast<index_type>(__static_padding_stride);
+  }
+
+  _LIBCPP_NO_UNIQUE_ADDRESS __padding_stride_type __padding_stride_{};
+  _LIBCPP_NO_UNIQUE_ADDRESS extents_type __extents_{};
+};
+
+#endif // _LIBCPP_STD_VER >= 26
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MDSPAN_LAYOUT_LEFT_PADDED_H
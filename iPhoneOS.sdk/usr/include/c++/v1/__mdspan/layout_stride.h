@@ -31,6 +31,7 @@
 #include <__type_traits/is_same.h>
 #include <__utility/as_const.h>
 #include <__utility/integer_sequence.h>
+#include <__utility/private_constructor_tag.h>
 #include <__utility/swap.h>
 #include <array>
 #include <limits>
@@ -63,6 +64,29 @@ concept __layout_mapping_alike = requires {
   bool_constant<_Mapping::is_always_exhaustive()>::value;
   bool_constant<_Mapping::is_always_unique()>::value;
 };
+
+#  if _LIBCPP_STD_VER >= 26
+template <class _Mapping>
+concept __is_layout_left_padded_mapping_of = requires {
+  _Mapping::padding_value;
+  requires __is_mapping_of<layout_left_padded<_Mapping::padding_value>, _Mapping>;
+};
+
+template <class _Mapping>
+concept __is_layout_right_padded_mapping_of = requires {
+  _Mapping::padding_value;
+  requires __is_mapping_of<layout_right_padded<_Mapping::padding_value>, _Mapping>;
+};
+#  endif
+
+// The mappings of the standard layouts other than layout_stride convert implicitly to layout_stride::mapping
+template <class _Mapping>
+constexpr bool __is_standard_strided_mapping =
+    __is_mapping_of<layout_left, _Mapping> || __is_mapping_of<layout_right, _Mapping> ||
+#  if _LIBCPP_STD_VER >= 26
+    __is_layout_left_padded_mapping_of<_Mapping> || __is_layout_right_padded_mapping_of<_Mapping> ||
+#  endif
+    __is_mapping_of<layout_stride, _Mapping>;
 } // namespace __mdspan_detail
 
 template <class _Extents>
@@ -220,15 +244,21 @@ public:
                                           const array<_OtherIndexType, __rank_>& __strides) noexcept
       : mapping(__ext, span(__strides)) {}
 
+  // Used by submdspan_mapping. A strided slice of a unique mapping is unique, but its strides do not necessarily
+  // satisfy the sufficient condition for uniqueness checked above, e.g. every other index of a contiguous dimension.
+  _LIBCPP_HIDE_FROM_ABI constexpr mapping(
+      __private_constructor_tag, const extents_type& __ext, const array<index_type, __rank_>& __strides) noexcept
+      : __extents_(__ext), __strides_([&]<size_t... _Pos>(index_sequence<_Pos...>) {
+          return __mdspan_detail::__possibly_empty_array<index_type, __rank_>{__strides[_Pos]...};
+        }(make_index_sequence<__rank_>())) {}
+
   template <class _StridedLayoutMapping>
     requires(__mdspan_detail::__layout_mapping_alike<_StridedLayoutMapping> &&
              is_constructible_v<extents_type, typename _StridedLayoutMapping::extents_type> &&
              _StridedLayoutMapping::is_always_unique() && _StridedLayoutMapping::is_always_strided())
   _LIBCPP_HIDE_FROM_ABI constexpr explicit(
       !(is_convertible_v<typename _StridedLayoutMapping::extents_type, extents_type> &&
-        (__mdspan_detail::__is_mapping_of<layout_left, _StridedLayoutMapping> ||
-         __mdspan_detail::__is_mapping_of<layout_right, _StridedLayoutMapping> ||
-         __mdspan_detail::__is_mapping_of<layout_stride, _StridedLayoutMapping>)))
+        __mdspan_detail::__is_standard_strided_mapping<_StridedLayoutMapping>))
       mapping(const _StridedLayoutMapping& __other) noexcept
       : __extents_(__other.extents()), __strides_([&]<size_t... _Pos>(index_sequence<_Pos...>) {
           // stride() only compiles for rank > 0
@@ -357,6 +387,14 @@ public:
     }
   }
 
+#  if _LIBCPP_STD_VER >= 26
+  // [mdspan.sub.map], submdspan mapping specialization
+  template <class... _SliceSpecifiers>
+  _LIBCPP_HIDE_FROM_ABI friend constexpr auto submdspan_mapping(const mapping& __src, _SliceSpecifiers... __slices) {
+    return __mdspan_detail::__submdspan_mapping(__src, __slices...);
+  }
+#  endif
+
 private:
   _LIBCPP_NO_UNIQUE_ADDRESS extents_type __extents_{};
   _LIBCPP_NO_UNIQUE_ADDRESS __mdspan_detail::__possibly_empty_array<index_type, __rank_> __strides_{};
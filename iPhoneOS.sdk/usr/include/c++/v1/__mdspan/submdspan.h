@@ -0,0 +1,47 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===---------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MDSPAN_SUBMDSPAN_H
+#define _LIBCPP___MDSPAN_SUBMDSPAN_H
+
+#include <__config>
+#include <__fwd/mdspan.h>
+#include <__mdspan/mdspan.h>
+#include <__mdspan/submdspan_extents.h>
+#include <__mdspan/submdspan_mapping.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 26
+
+// [mdspan.sub.sub], submdspan function template
+template <class _ElementType, class _Extents, class _LayoutPolicy, class _AccessorPolicy, class... _SliceSpecifiers>
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI constexpr auto
+submdspan(const mdspan<_ElementType, _Extents, _LayoutPolicy, _AccessorPolicy>& __src, _SliceSpecifiers... __slices) {
+  // submdspan_mapping is a customization point of the layout mapping, found by argument dependent lookup.
+  auto __sub_map_result = submdspan_mapping(__src.mapping(), __slices...);
+  return mdspan(__src.accessor().offset(__src.data_handle(), __sub_map_result.offset),
+                __sub_map_result.mapping,
+                typename _AccessorPolicy::offset_policy(__src.accessor()));
+}
+
+#endif // _LIBCPP_STD_VER >= 26
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MDSPAN_SUBMDSPAN_H
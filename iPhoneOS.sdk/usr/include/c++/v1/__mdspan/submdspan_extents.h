@@ -0,0 +1,251 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===---------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MDSPAN_SUBMDSPAN_EXTENTS_H
+#define _LIBCPP___MDSPAN_SUBMDSPAN_EXTENTS_H
+
+#include <__assert>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__fwd/get.h>
+#include <__fwd/mdspan.h>
+#include <__mdspan/extents.h>
+#include <__tuple/tuple_element.h>
+#include <__tuple/tuple_like_no_subrange.h>
+#include <__type_traits/integer_traits.h>
+#include <__type_traits/is_convertible.h>
+#include <__type_traits/remove_cvref.h>
+#include <__utility/integer_sequence.h>
+#include <array>
+#include <span>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 26
+
+// [mdspan.sub.strided.slice], strided_slice
+template <class _OffsetType, class _ExtentType, class _StrideType>
+struct strided_slice {
+  using offset_type = _OffsetType;
+  using extent_type = _ExtentType;
+  using stride_type = _StrideType;
+
+  static_assert(__signed_or_unsigned_integer<offset_type> || __integral_constant_like<offset_type>,
+                "strided_slice::offset_type must be a signed or unsigned integer type or integral-constant-like.");
+  static_assert(__signed_or_unsigned_integer<extent_type> || __integral_constant_like<extent_type>,
+                "strided_slice::extent_type must be a signed or unsigned integer type or integral-constant-like.");
+  static_assert(__signed_or_unsigned_integer<stride_type> || __integral_constant_like<stride_type>,
+                "strided_slice::stride_type must be a signed or unsigned integer type or integral-constant-like.");
+
+  _LIBCPP_NO_UNIQUE_ADDRESS offset_type offset{};
+  _LIBCPP_NO_UNIQUE_ADDRESS extent_type extent{};
+  _LIBCPP_NO_UNIQUE_ADDRESS stride_type stride{};
+};
+
+// [mdspan.sub.map.result], submdspan_mapping_result
+template <class _LayoutMapping>
+struct submdspan_mapping_result {
+  _LIBCPP_NO_UNIQUE_ADDRESS _LayoutMapping mapping = _LayoutMapping();
+  size_t offset;
+};
+
+struct full_extent_t {
+  explicit full_extent_t() = default;
+};
+
+inline constexpr full_extent_t full_extent{};
+
+namespace __mdspan_detail {
+template <class _Tp>
+inline constexpr bool __is_strided_slice = false;
+
+template <class _OffsetType, class _ExtentType, class _StrideType>
+inline constexpr bool __is_strided_slice<strided_slice<_OffsetType, _ExtentType, _StrideType>> = true;
+
+// index-pair-like in [mdspan.syn]
+template <class _Tp, class _IndexType>
+concept __index_pair_like =
+    __pair_like_no_subrange<_Tp> && is_convertible_v<tuple_element_t<0, _Tp>, _IndexType> &&
+    is_convertible_v<tuple_element_t<1, _Tp>, _IndexType>;
+
+// A slice which selects a single index, and thus removes its dimension from the result.
+template <class _Slice, class _IndexType>
+inline constexpr bool __is_index_slice = is_convertible_v<_Slice, _IndexType>;
+
+// A slice which selects a contiguous range of indices.
+template <class _Slice, class _IndexType>
+inline constexpr bool __is_unit_stride_slice = [] {
+  if constexpr (is_convertible_v<_Slice, full_extent_t> || __index_pair_like<_Slice, _IndexType>) {
+    return true;
+  } else if constexpr (__is_strided_slice<_Slice>) {
+    if constexpr (__integral_constant_like<typename _Slice::stride_type>)
+      return _Slice::stride_type::value == 1;
+    else
+      return false;
+  } else {
+    return false;
+  }
+}();
+
+template <size_t _Np, class _First, class... _Rest>
+_LIBCPP_HIDE_FROM_ABI constexpr const auto& __slice_at(const _First& __first, const _Rest&... __rest) noexcept {
+  if constexpr (_Np == 0)
+    return __first;
+  else
+    return __mdspan_detail::__slice_at<_Np - 1>(__rest...);
+}
+
+// first_ in [mdspan.sub.helpers]
+template <class _IndexType, class _Slice>
+_LIBCPP_HIDE_FROM_ABI constexpr _IndexType __first_of(const _Slice& __slice) {
+  if constexpr (__is_index_slice<_Slice, _IndexType>)
+    return static_cast<_IndexType>(__slice);
+  else if constexpr (__index_pair_like<_Slice, _IndexType>)
+    return static_cast<_IndexType>(std::get<0>(__slice));
+  else if constexpr (__is_strided_slice<_Slice>)
+    return static_cast<_IndexType>(__slice.offset);
+  else
+    return 0;
+}
+
+// last_ in [mdspan.sub.helpers]
+template <size_t _Rp, class _Extents, class _Slice>
+_LIBCPP_HIDE_FROM_ABI constexpr typename _Extents::index_type __last_of(const _Extents& __src, const _Slice& __slice) {
+  using _IndexType = typename _Extents::index_type;
+  if constexpr (__is_index_slice<_Slice, _IndexType>)
+    return static_cast<_IndexType>(__slice) + 1;
+  else if constexpr (__index_pair_like<_Slice, _IndexType>)
+    return static_cast<_IndexType>(std::get<1>(__slice));
+  else if constexpr (__is_strided_slice<_Slice>)
+    return static_cast<_IndexType>(__slice.offset) + static_cast<_IndexType>(__slice.extent);
+  else
+    return __src.extent(_Rp);
+}
+
+// The number of dimensions kept by the slices.
+template <class _IndexType, class... _Slices>
+inline constexpr size_t __subrank = (0 + ... + static_cast<size_t>(!__is_index_slice<_Slices, _IndexType>));
+
+// For every dimension of the result, the dimension of the source it comes from.
+template <class _IndexType, class... _Slices>
+inline constexpr auto __subrank_map = [] {
+  array<size_t, __subrank<_IndexType, _Slices...>> __map{};
+  size_t __k = 0;
+  size_t __r = 0;
+  ((__is_index_slice<_Slices, _IndexType> ? void() : void(__map[__k++] = __r), ++__r), ...);
+  return __map;
+}();
+
+// The static extent of the dimension selected by a slice of type _Slice from a dimension with static extent
+// _StaticExtent, see [mdspan.sub.extents].
+template <class _IndexType, size_t _StaticExtent, class _Slice>
+_LIBCPP_HIDE_FROM_ABI consteval size_t __static_subextent() {
+  if constexpr (is_convertible_v<_Slice, full_extent_t>) {
+    return _StaticExtent;
+  } else if constexpr (__index_pair_like<_Slice, _IndexType>) {
+    using _First  = remove_cvref_t<tuple_element_t<0, _Slice>>;
+    using _Second = remove_cvref_t<tuple_element_t<1, _Slice>>;
+    if constexpr (__integral_constant_like<_First> && __integral_constant_like<_Second>)
+      return static_cast<size_t>(_Second::value - _First::value);
+    else
+      return dynamic_extent;
+  } else if constexpr (__is_strided_slice<_Slice>) {
+    using _ExtentType = typename _Slice::extent_type;
+    using _StrideType = typename _Slice::stride_type;
+    if constexpr (!__integral_constant_like<_ExtentType>)
+      return dynamic_extent;
+    else if constexpr (_ExtentType::value == 0)
+      return 0;
+    else if constexpr (__integral_constant_like<_StrideType>)
+      return static_cast<size_t>(1 + (_ExtentType::value - 1) / _StrideType::value);
+    else
+      return dynamic_extent;
+  } else {
+    return dynamic_extent;
+  }
+}
+
+template <class _Extents, class... _Slices, size_t... _Ks>
+_LIBCPP_HIDE_FROM_ABI auto __subextents_type_impl(index_sequence<_Ks...>) {
+  using _IndexType                      = typename _Extents::index_type;
+  [[maybe_unused]] constexpr auto __map = __subrank_map<_IndexType, _Slices...>;
+  constexpr auto __static_extent        = []<size_t... _Rs>(index_sequence<_Rs...>) {
+    return array<size_t, _Extents::rank()>{
+        __mdspan_detail::__static_subextent<_IndexType, _Extents::static_extent(_Rs), _Slices>()...};
+  }(make_index_sequence<_Extents::rank()>());
+  return extents<_IndexType, __static_extent[__map[_Ks]]...>();
+}
+
+// The type of submdspan_extents(declval<_Extents>(), declval<_Slices>()...)
+template <class _Extents, class... _Slices>
+using __subextents_t _LIBCPP_NODEBUG = decltype(__mdspan_detail::__subextents_type_impl<_Extents, _Slices...>(
+    make_index_sequence<__subrank<typename _Extents::index_type, _Slices...>>()));
+
+// The extent of the dimension selected by __slices...[_Rp].
+template <size_t _Rp, class _Extents, class... _Slices>
+_LIBCPP_HIDE_FROM_ABI constexpr typename _Extents::index_type
+__subextent(const _Extents& __src, const _Slices&... __slices) {
+  using _IndexType    = typename _Extents::index_type;
+  const auto& __slice = __mdspan_detail::__slice_at<_Rp>(__slices...);
+  using _Slice        = remove_cvref_t<decltype(__slice)>;
+  if constexpr (__is_strided_slice<_Slice>) {
+    _IndexType __extent = static_cast<_IndexType>(__slice.extent);
+    return __extent == 0 ? 0 : 1 + (__extent - 1) / static_cast<_IndexType>(__slice.stride);
+  } else {
+    return __mdspan_detail::__last_of<_Rp>(__src, __slice) - __mdspan_detail::__first_of<_IndexType>(__slice);
+  }
+}
+
+// Checks the preconditions of [mdspan.sub.extents] for the slice of dimension _Rp.
+template <size_t _Rp, class _Extents, class _Slice>
+_LIBCPP_HIDE_FROM_ABI constexpr bool __is_valid_slice(const _Extents& __src, const _Slice& __slice) {
+  using _IndexType   = typename _Extents::index_type;
+  _IndexType __first = __mdspan_detail::__first_of<_IndexType>(__slice);
+  _IndexType __last  = __mdspan_detail::__last_of<_Rp>(__src, __slice);
+  if constexpr (__is_strided_slice<_Slice>) {
+    if (static_cast<_IndexType>(__slice.extent) != 0 && static_cast<_IndexType>(__slice.stride) <= 0)
+      return false;
+  }
+  return 0 <= __first && __first <= __last && __last <= __src.extent(_Rp);
+}
+} // namespace __mdspan_detail
+
+// [mdspan.sub.extents], submdspan_extents
+template <class _IndexType, size_t... _Extents, class... _SliceSpecifiers>
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI constexpr auto
+submdspan_extents(const extents<_IndexType, _Extents...>& __src, _SliceSpecifiers... __slices) {
+  static_assert(sizeof...(_SliceSpecifiers) == sizeof...(_Extents),
+                "submdspan_extents: the number of slices must be equal to the rank of the extents.");
+  using _SubExtents    = __mdspan_detail::__subextents_t<extents<_IndexType, _Extents...>, _SliceSpecifiers...>;
+  constexpr auto __map = __mdspan_detail::__subrank_map<_IndexType, _SliceSpecifiers...>;
+
+  _LIBCPP_ASSERT_VALID_ELEMENT_ACCESS(
+      ([&]<size_t... _Rs>(index_sequence<_Rs...>) {
+        return (__mdspan_detail::__is_valid_slice<_Rs>(__src, __slices) && ... && true);
+      }(make_index_sequence<sizeof...(_Extents)>())),
+      "submdspan_extents: the slices must select a valid subset of the extents.");
+  return [&]<size_t... _Ks>(index_sequence<_Ks...>) {
+    return _SubExtents(__mdspan_detail::__subextent<__map[_Ks]>(__src, __slices...)...);
+  }(make_index_sequence<_SubExtents::rank()>());
+}
+
+#endif // _LIBCPP_STD_VER >= 26
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MDSPAN_SUBMDSPAN_EXTENTS_H
@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===---------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MDSPAN_SUBMDSPAN_MAPPING_H
+#define _LIBCPP___MDSPAN_SUBMDSPAN_MAPPING_H
+
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__fwd/mdspan.h>
+#include <__mdspan/extents.h>
+#include <__mdspan/layout_left.h>
+#include <__mdspan/layout_left_padded.h>
+#include <__mdspan/layout_right.h>
+#include <__mdspan/layout_right_padded.h>
+#include <__mdspan/layout_stride.h>
+#include <__mdspan/submdspan_extents.h>
+#include <__type_traits/conditional.h>
+#include <__type_traits/is_convertible.h>
+#include <__type_traits/remove_cvref.h>
+#include <__utility/integer_sequence.h>
+#include <__utility/private_constructor_tag.h>
+#include <array>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 26
+
+namespace __mdspan_detail {
+
+template <class _Mapping>
+inline constexpr bool __is_padded_mapping =
+    __is_layout_left_padded_mapping_of<_Mapping> || __is_layout_right_padded_mapping_of<_Mapping>;
+
+template <class _Mapping>
+inline constexpr bool __is_left_family_mapping =
+    __is_mapping_of<layout_left, _Mapping> || __is_layout_left_padded_mapping_of<_Mapping>;
+
+template <class _Mapping>
+inline constexpr bool __is_right_family_mapping =
+    __is_mapping_of<layout_right, _Mapping> || __is_layout_right_padded_mapping_of<_Mapping>;
+
+// The layout of the result of submdspan_mapping, see [mdspan.sub.map.left], [mdspan.sub.map.right],
+// [mdspan.sub.map.leftpad] and [mdspan.sub.map.rightpad].
+enum class __sublayout_kind { __unpadded, __padded, __strided };
+
+template <class _Mapping, class... _Slices>
+_LIBCPP_HIDE_FROM_ABI consteval __sublayout_kind __sublayout() {
+  using _IndexType = typename _Mapping::index_type;
+  if constexpr (!__is_left_family_mapping<_Mapping> && !__is_right_family_mapping<_Mapping>) {
+    return __sublayout_kind::__strided;
+  } else {
+    // For the layout_right family the contiguous dimension is the last one. The analysis is the same as for the
+    // layout_left family, with the order of the slices reversed.
+    constexpr bool __from_right                 = __is_right_family_mapping<_Mapping>;
+    constexpr size_t __rank                     = sizeof...(_Slices);
+    constexpr bool __is_index[__rank + 1]       = {__is_index_slice<_Slices, _IndexType>...};
+    constexpr bool __is_full[__rank + 1]        = {is_convertible_v<_Slices, full_extent_t>...};
+    constexpr bool __is_unit_stride[__rank + 1] = {__is_unit_stride_slice<_Slices, _IndexType>...};
+    auto __at = [&](const bool* __a, size_t __i) { return __a[__from_right ? __rank - 1 - __i : __i]; };
+
+    // The dimensions of the source which are kept, counted from the contiguous one.
+    size_t __kept[__rank + 1] = {};
+    size_t __subrank          = 0;
+    for (size_t __i = 0; __i < __rank; ++__i)
+      if (!__at(__is_index, __i))
+        __kept[__subrank++] = __i;
+
+    if (__subrank == 0)
+      return __sublayout_kind::__unpadded;
+
+    // Whether the first __n kept dimensions directly follow each other, starting at the contiguous dimension.
+    auto __leading = [&](size_t __n) {
+      for (size_t __j = 0; __j < __n; ++__j)
+        if (__kept[__j] != __j)
+          return false;
+      return true;
+    };
+    auto __all_full = [&](size_t __first, size_t __last) {
+      for (size_t __j = __first; __j < __last; ++__j)
+        if (!__at(__is_full, __kept[__j]))
+          return false;
+      return true;
+    };
+
+    // A padded source can only drop its padding if a single dimension is kept.
+    if (!__is_padded_mapping<_Mapping> && __leading(__subrank) && __all_full(0, __subrank - 1) &&
+        __at(__is_unit_stride, __kept[__subrank - 1]))
+      return __sublayout_kind::__unpadded;
+    if (__is_padded_mapping<_Mapping> && __subrank == 1 && __kept[0] == 0 && __at(__is_unit_stride, 0))
+      return __sublayout_kind::__unpadded;
+    // With two kept dimensions the outer one can be anywhere, its stride becomes the padded stride.
+    if (__subrank >= 2 && __leading(__subrank == 2 ? 1 : __subrank) && __at(__is_unit_stride, 0) &&
+        __all_full(1, __subrank - 1) && __at(__is_unit_stride, __kept[__subrank - 1]))
+      return __sublayout_kind::__padded;
+    return __sublayout_kind::__strided;
+  }
+}
+
+// The stride of the dimension selected by __slices...[_Rp].
+template <size_t _Rp, class _Mapping, class... _Slices>
+_LIBCPP_HIDE_FROM_ABI constexpr typename _Mapping::index_type
+__substride(const _Mapping& __src, const _Slices&... __slices) {
+  using _IndexType    = typename _Mapping::index_type;
+  const auto& __slice = __mdspan_detail::__slice_at<_Rp>(__slices...);
+  if constexpr (__is_strided_slice<remove_cvref_t<decltype(__slice)>>) {
+    // A slice with a stride larger than its extent selects a single index, keep the stride of the source for it.
+    _IndexType __stride = static_cast<_IndexType>(__slice.stride);
+    if (__stride < static_cast<_IndexType>(__slice.extent))
+      return __src.stride(_Rp) * __stride;
+  }
+  return __src.stride(_Rp);
+}
+
+template <class _SubExtents, class _Mapping, class... _Slices>
+_LIBCPP_HIDE_FROM_ABI constexpr size_t
+__suboffset(const _Mapping& __src, const _SubExtents& __sub_ext, const _Slices&... __slices) {
+  using _IndexType = typename _Mapping::index_type;
+  // If the result is empty, the first indices may be out of the bounds of the source.
+  for (size_t __r = 0; __r < _SubExtents::rank(); ++__r)
+    if (__sub_ext.extent(__r) == 0)
+      return static_cast<size_t>(__src.required_span_size());
+  return static_cast<size_t>(__src(__mdspan_detail::__first_of<_IndexType>(__slices)...));
+}
+
+template <class _Mapping, class... _SliceSpecifiers>
+_LIBCPP_HIDE_FROM_ABI constexpr auto __submdspan_mapping(const _Mapping& __src, _SliceSpecifiers... __slices) {
+  using _Extents   = typename _Mapping::extents_type;
+  using _IndexType = typename _Extents::index_type;
+  static_assert(sizeof...(_SliceSpecifiers) == _Extents::rank(),
+                "submdspan_mapping: the number of slices must be equal to the rank of the mapping.");
+
+  auto __sub_ext       = std::submdspan_extents(__src.extents(), __slices...);
+  using _SubExtents    = decltype(__sub_ext);
+  size_t __offset      = __mdspan_detail::__suboffset(__src, __sub_ext, __slices...);
+
+  constexpr size_t __subrank        = _SubExtents::rank();
+  constexpr bool __is_left          = __is_left_family_mapping<_Mapping>;
+  constexpr __sublayout_kind __kind = __mdspan_detail::__sublayout<_Mapping, _SliceSpecifiers...>();
+
+  if constexpr (__kind == __sublayout_kind::__unpadded) {
+    using _Layout _LIBCPP_NODEBUG = conditional_t<__is_left, layout_left, layout_right>;
+    return submdspan_mapping_result<typename _Layout::template mapping<_SubExtents>>{
+        typename _Layout::template mapping<_SubExtents>(__sub_ext), __offset};
+  } else if constexpr (__kind == __sublayout_kind::__padded) {
+    // The padded stride is the stride of the second kept dimension, counted from the contiguous one.
+    constexpr auto __map           = __subrank_map<_IndexType, _SliceSpecifiers...>;
+    constexpr size_t __padded_rank = __is_left ? __map[1] : __map[__subrank - 2];
+    using _Layout _LIBCPP_NODEBUG =
+        conditional_t<__is_left, layout_left_padded<dynamic_extent>, layout_right_padded<dynamic_extent>>;
+    return submdspan_mapping_result<typename _Layout::template mapping<_SubExtents>>{
+        typename _Layout::template mapping<_SubExtents>(__sub_ext, __src.stride(__padded_rank)), __offset};
+  } else {
+    constexpr auto __map = __subrank_map<_IndexType, _SliceSpecifiers...>;
+    return [&]<size_t... _Ks>(index_sequence<_Ks...>) {
+      return submdspan_mapping_result<layout_stride::mapping<_SubExtents>>{
+          layout_stride::mapping<_SubExtents>(
+              __private_constructor_tag(),
+              __sub_ext,
+              array<_IndexType, __subrank>{__mdspan_detail::__substride<__map[_Ks]>(__src, __slices...)...}),
+          __offset};
+    }(make_index_sequence<__subrank>());
+  }
+}
+
+} // namespace __mdspan_detail
+
+#endif // _LIBCPP_STD_VER >= 26
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MDSPAN_SUBMDSPAN_MAPPING_H
@@ -0,0 +1,262 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MEMORY_ATOMIC_SHARED_PTR_H
+#define _LIBCPP___MEMORY_ATOMIC_SHARED_PTR_H
+
+#include <__atomic/atomic.h>
+#include <__atomic/memory_order.h>
+#include <__config>
+#include <__cstddef/nullptr_t.h>
+#include <__memory/shared_count.h>
+#include <__memory/shared_ptr.h>
+#include <__thread/support.h>
+#include <__utility/move.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS
+
+// atomic<shared_ptr<T>> and atomic<weak_ptr<T>> keep the (pointer, control block)
+// pair in a single atomic object, so that loads are lock-free whenever the
+// platform has a double-width compare-and-swap.
+//
+// A reader still has to increment the reference count of the control block it
+// just loaded, while a writer may be replacing the value and dropping the last
+// reference at the same time. Rather than serializing both on a lock, readers
+// announce themselves in one of two counters selected by an epoch, and writers
+// defer releasing the reference they replaced until all the readers that could
+// have seen it have left. This is the two-phase grace period used by RCU:
+// readers never wait, and writers only wait for readers already in flight.
+class __sp_grace_period {
+  atomic<unsigned> __epoch_;
+  atomic<long> __readers_[2];
+  atomic<bool> __writer_;
+
+  static const int __spin_count = 64;
+
+  template <class _Pred>
+  _LIBCPP_HIDE_FROM_ABI static void __spin_until(_Pred __pred) _NOEXCEPT {
+    for (int __i = 0; !__pred(); ++__i) {
+      if (__i >= __spin_count)
+        std::__libcpp_thread_yield();
+    }
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI constexpr __sp_grace_period() _NOEXCEPT : __epoch_(0), __readers_{0, 0}, __writer_(false) {}
+
+  __sp_grace_period(const __sp_grace_period&)            = delete;
+  __sp_grace_period& operator=(const __sp_grace_period&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI unsigned __enter() _NOEXCEPT {
+    unsigned __slot = __epoch_.load() & 1;
+    __readers_[__slot].fetch_add(1);
+    return __slot;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __leave(unsigned __slot) _NOEXCEPT {
+    __readers_[__slot].fetch_sub(1, memory_order_release);
+  }
+
+  // Returns once every reader that entered before the call has left. Writers
+  // are serialized here, because the two flips of the epoch must not interleave.
+  _LIBCPP_HIDE_FROM_ABI void __synchronize() _NOEXCEPT {
+    __spin_until([this] { return !__writer_.exchange(true, memory_order_acquire); });
+    for (int __phase = 0; __phase != 2; ++__phase) {
+      unsigned __slot = __epoch_.fetch_add(1) & 1;
+      __spin_until([this, __slot] { return __readers_[__slot].load() == 0; });
+    }
+    __writer_.store(false, memory_order_release);
+  }
+};
+
+template <class _SmartPtr, bool _IsWeak>
+struct __atomic_smart_ptr {
+  using value_type = _SmartPtr;
+
+private:
+  using element_type = typename _SmartPtr::element_type;
+
+  struct __rep {
+    element_type* __ptr_;
+    __shared_weak_count* __cntrl_;
+  };
+
+  atomic<__rep> __rep_;
+  mutable __sp_grace_period __grace_;
+
+  _LIBCPP_HIDE_FROM_ABI static __rep __get(const _SmartPtr& __p) _NOEXCEPT { return __rep{__p.__ptr_, __p.__cntrl_}; }
+
+  // Takes over the reference owned by __p.
+  _LIBCPP_HIDE_FROM_ABI static __rep __release(_SmartPtr& __p) _NOEXCEPT {
+    __rep __r    = __get(__p);
+    __p.__ptr_   = nullptr;
+    __p.__cntrl_ = nullptr;
+    return __r;
+  }
+
+  // Gives the reference owned by __r to a new smart pointer.
+  _LIBCPP_HIDE_FROM_ABI static _SmartPtr __adopt(__rep __r) _NOEXCEPT {
+    _SmartPtr __p;
+    __p.__ptr_   = __r.__ptr_;
+    __p.__cntrl_ = __r.__cntrl_;
+    return __p;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static void __add_ref(__rep __r) _NOEXCEPT {
+    if (__r.__cntrl_ == nullptr)
+      return;
+    if constexpr (_IsWeak)
+      __r.__cntrl_->__add_weak();
+    else
+      __r.__cntrl_->__add_shared();
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static void __drop_ref(__rep __r) _NOEXCEPT {
+    if (__r.__cntrl_ == nullptr)
+      return;
+    if constexpr (_IsWeak)
+      __r.__cntrl_->__release_weak();
+    else
+      __r.__cntrl_->__release_shared();
+  }
+
+  // Loads the current value and takes a reference to it.
+  _LIBCPP_HIDE_FROM_ABI __rep __acquire() const _NOEXCEPT {
+    unsigned __slot = __grace_.__enter();
+    __rep __r       = __rep_.load();
+    __add_ref(__r);
+    __grace_.__leave(__slot);
+    return __r;
+  }
+
+  // Waits until no reader can still be about to take a reference to __r, which
+  // was just unlinked from this object.
+  _LIBCPP_HIDE_FROM_ABI void __unlinked(__rep __r) _NOEXCEPT {
+    if (__r.__cntrl_ != nullptr)
+      __grace_.__synchronize();
+  }
+
+public:
+  static constexpr bool is_always_lock_free = atomic<__rep>::is_always_lock_free;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __atomic_smart_ptr() _NOEXCEPT : __rep_(__rep{nullptr, nullptr}) {}
+  _LIBCPP_HIDE_FROM_ABI __atomic_smart_ptr(_SmartPtr __desired) _NOEXCEPT : __rep_(__release(__desired)) {}
+
+  __atomic_smart_ptr(const __atomic_smart_ptr&)            = delete;
+  __atomic_smart_ptr& operator=(const __atomic_smart_ptr&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI ~__atomic_smart_ptr() { __drop_ref(__rep_.load(memory_order_relaxed)); }
+
+  _LIBCPP_HIDE_FROM_ABI bool is_lock_free() const _NOEXCEPT { return __rep_.is_lock_free(); }
+
+  // The memory orders are accepted for conformance, but every operation is
+  // sequentially consistent: the grace period relies on it.
+  _LIBCPP_HIDE_FROM_ABI _SmartPtr load(memory_order = memory_order_seq_cst) const _NOEXCEPT {
+    return __adopt(__acquire());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI operator _SmartPtr() const _NOEXCEPT { return load(); }
+
+  _LIBCPP_HIDE_FROM_ABI void store(_SmartPtr __desired, memory_order = memory_order_seq_cst) _NOEXCEPT {
+    __rep __old = __rep_.exchange(__release(__desired));
+    __unlinked(__old);
+    __drop_ref(__old);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI _SmartPtr exchange(_SmartPtr __desired, memory_order = memory_order_seq_cst) _NOEXCEPT {
+    __rep __old = __rep_.exchange(__release(__desired));
+    __unlinked(__old);
+    return __adopt(__old);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool
+  compare_exchange_strong(_SmartPtr& __expected, _SmartPtr __desired, memory_order, memory_order) _NOEXCEPT {
+    __rep __old     = __get(__expected);
+    unsigned __slot = __grace_.__enter();
+    if (__rep_.compare_exchange_strong(__old, __get(__desired))) {
+      __grace_.__leave(__slot);
+      __release(__desired);
+      __unlinked(__old);
+      __drop_ref(__old);
+      return true;
+    }
+    // __old now holds the current value, which the read-side section keeps alive.
+    __add_ref(__old);
+    __grace_.__leave(__slot);
+    __expected = __adopt(__old);
+    return false;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool compare_exchange_weak(
+      _SmartPtr& __expected, _SmartPtr __desired, memory_order __success, memory_order __failure) _NOEXCEPT {
+    return compare_exchange_strong(__expected, std::move(__desired), __success, __failure);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool compare_exchange_strong(
+      _SmartPtr& __expected, _SmartPtr __desired, memory_order __order = memory_order_seq_cst) _NOEXCEPT {
+    return compare_exchange_strong(__expected, std::move(__desired), __order, __order);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool compare_exchange_weak(
+      _SmartPtr& __expected, _SmartPtr __desired, memory_order __order = memory_order_seq_cst) _NOEXCEPT {
+    return compare_exchange_strong(__expected, std::move(__desired), __order, __order);
+  }
+
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void
+  wait(_SmartPtr __old, memory_order = memory_order_seq_cst) const _NOEXCEPT {
+    __rep_.wait(__get(__old));
+  }
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void notify_one() _NOEXCEPT { __rep_.notify_one(); }
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void notify_all() _NOEXCEPT { __rep_.notify_all(); }
+};
+
+template <class _Tp>
+struct atomic<shared_ptr<_Tp> > : __atomic_smart_ptr<shared_ptr<_Tp>, false> {
+  using __base _LIBCPP_NODEBUG = __atomic_smart_ptr<shared_ptr<_Tp>, false>;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr atomic() _NOEXCEPT = default;
+  _LIBCPP_HIDE_FROM_ABI constexpr atomic(nullptr_t) _NOEXCEPT : atomic() {}
+  _LIBCPP_HIDE_FROM_ABI atomic(shared_ptr<_Tp> __desired) _NOEXCEPT : __base(std::move(__desired)) {}
+
+  atomic(const atomic&)         = delete;
+  void operator=(const atomic&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI void operator=(shared_ptr<_Tp> __desired) _NOEXCEPT { this->store(std::move(__desired)); }
+  _LIBCPP_HIDE_FROM_ABI void operator=(nullptr_t) _NOEXCEPT { this->store(nullptr); }
+};
+
+template <class _Tp>
+struct atomic<weak_ptr<_Tp> > : __atomic_smart_ptr<weak_ptr<_Tp>, true> {
+  using __base _LIBCPP_NODEBUG = __atomic_smart_ptr<weak_ptr<_Tp>, true>;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr atomic() _NOEXCEPT = default;
+  _LIBCPP_HIDE_FROM_ABI atomic(weak_ptr<_Tp> __desired) _NOEXCEPT : __base(std::move(__desired)) {}
+
+  atomic(const atomic&)         = delete;
+  void operator=(const atomic&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI void operator=(weak_ptr<_Tp> __desired) _NOEXCEPT { this->store(std::move(__desired)); }
+};
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MEMORY_ATOMIC_SHARED_PTR_H
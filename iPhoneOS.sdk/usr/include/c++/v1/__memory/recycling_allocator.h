@@ -0,0 +1,220 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MEMORY_RECYCLING_ALLOCATOR_H
+#define _LIBCPP___MEMORY_RECYCLING_ALLOCATOR_H
+
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__memory/addressof.h>
+#include <__memory/allocator.h>
+#include <__memory/allocator_traits.h>
+#include <__new/placement_new_delete.h>
+#include <__type_traits/integral_constant.h>
+#include <__type_traits/is_same.h>
+#include <__utility/exchange.h>
+#include <__utility/forward.h>
+#include <__utility/move.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_NODE_RECYCLING
+
+// The number of nodes a recycling_allocator obtained from and gave back to its underlying allocator, and how many of
+// its allocations were served from its free list instead.
+struct recycling_allocator_stats {
+  size_t allocated = 0; // nodes obtained from the underlying allocator
+  size_t reused    = 0; // allocations served from the free list
+  size_t recycled  = 0; // deallocations kept on the free list
+  size_t released  = 0; // nodes given back to the underlying allocator
+};
+
+// An allocator adaptor which keeps up to _Capacity of the single objects deallocated through it on a free list, and
+// hands them out again instead of calling the underlying allocator. list, map, set and the unordered containers
+// allocate each of their nodes on its own, so with this allocator a container which keeps erasing and inserting
+// elements, like an LRU cache, stops calling the underlying allocator once its free list is warm. Arrays, like the
+// buckets of the unordered containers, are passed through.
+//
+// The free list belongs to the allocator object, and thus to the container it is stored in. A copy, including the
+// rebound copy a container makes for its nodes, starts with an empty free list and the statistics of the original,
+// so c.get_allocator().stats() reports the statistics of the nodes of c. Moving an allocator moves its free list.
+// The cached nodes are given back to the underlying allocator when the allocator is destroyed.
+template <class _Tp, size_t _Capacity = 64, class _Alloc = allocator<_Tp>>
+class recycling_allocator {
+  using _Traits _LIBCPP_NODEBUG = allocator_traits<_Alloc>;
+
+  static_assert(is_same<typename _Traits::value_type, _Tp>::value,
+                "recycling_allocator: the underlying allocator must have the same value_type");
+  static_assert(is_same<typename _Traits::pointer, _Tp*>::value,
+                "recycling_allocator: the underlying allocator must not use fancy pointers");
+
+  // Overlaid on the storage of a cached node.
+  struct __free_node {
+    __free_node* __next_;
+  };
+
+  static const bool __can_recycle =
+      _Capacity != 0 && sizeof(_Tp) >= sizeof(__free_node) && alignof(_Tp) >= alignof(__free_node);
+
+  template <class, size_t, class>
+  friend class recycling_allocator;
+
+public:
+  using value_type              = _Tp;
+  using size_type               = typename _Traits::size_type;
+  using difference_type         = typename _Traits::difference_type;
+  using upstream_allocator_type = _Alloc;
+
+  using propagate_on_container_copy_assignment = false_type;
+  using propagate_on_container_move_assignment = true_type;
+  using propagate_on_container_swap            = true_type;
+  using is_always_equal                        = typename _Traits::is_always_equal;
+
+  static constexpr size_t capacity = _Capacity;
+
+  template <class _Up>
+  struct rebind {
+    using other = recycling_allocator<_Up, _Capacity, __rebind_alloc<_Traits, _Up>>;
+  };
+
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator() = default;
+
+  _LIBCPP_HIDE_FROM_ABI explicit recycling_allocator(const _Alloc& __a) noexcept : __alloc_(__a) {}
+
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator(const recycling_allocator& __other) noexcept
+      : __alloc_(__other.__alloc_), __stats_(__other.__stats_) {}
+
+  template <class _Up, class _UpAlloc>
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator(const recycling_allocator<_Up, _Capacity, _UpAlloc>& __other) noexcept
+      : __alloc_(__other.__alloc_), __stats_(__other.__stats_) {}
+
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator(recycling_allocator&& __other) noexcept
+      : __alloc_(std::move(__other.__alloc_)),
+        __free_(std::exchange(__other.__free_, nullptr)),
+        __cached_(std::exchange(__other.__cached_, 0)),
+        __stats_(std::exchange(__other.__stats_, recycling_allocator_stats())) {}
+
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator& operator=(const recycling_allocator& __other) noexcept {
+    if (this != std::addressof(__other)) {
+      __release();
+      __alloc_ = __other.__alloc_;
+      __stats_ = __other.__stats_;
+    }
+    return *this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator& operator=(recycling_allocator&& __other) noexcept {
+    if (this != std::addressof(__other)) {
+      __release();
+      __alloc_  = std::move(__other.__alloc_);
+      __free_   = std::exchange(__other.__free_, nullptr);
+      __cached_ = std::exchange(__other.__cached_, 0);
+      __stats_  = std::exchange(__other.__stats_, recycling_allocator_stats());
+    }
+    return *this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI ~recycling_allocator() { __release(); }
+
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI _Tp* allocate(size_t __n) {
+    if (__n != 1)
+      return _Traits::allocate(__alloc_, __n);
+    if (__can_recycle && __free_ != nullptr) {
+      __free_node* __node = __free_;
+      __free_             = __node->__next_;
+      --__cached_;
+      ++__stats_.reused;
+      return reinterpret_cast<_Tp*>(__node);
+    }
+    _Tp* __p = _Traits::allocate(__alloc_, 1);
+    ++__stats_.allocated;
+    return __p;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void deallocate(_Tp* __p, size_t __n) noexcept {
+    if (__n != 1) {
+      _Traits::deallocate(__alloc_, __p, __n);
+      return;
+    }
+    if (__can_recycle && __cached_ < _Capacity) {
+      __free_ = ::new (static_cast<void*>(__p)) __free_node{__free_};
+      ++__cached_;
+      ++__stats_.recycled;
+      return;
+    }
+    _Traits::deallocate(__alloc_, __p, 1);
+    ++__stats_.released;
+  }
+
+  template <class _Up, class... _Args>
+  _LIBCPP_HIDE_FROM_ABI void construct(_Up* __p, _Args&&... __args) {
+    _Traits::construct(__alloc_, __p, std::forward<_Args>(__args)...);
+  }
+
+  template <class _Up>
+  _LIBCPP_HIDE_FROM_ABI void destroy(_Up* __p) {
+    _Traits::destroy(__alloc_, __p);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI size_type max_size() const noexcept { return _Traits::max_size(__alloc_); }
+
+  // A copy of a container starts with an empty free list and no statistics.
+  _LIBCPP_HIDE_FROM_ABI recycling_allocator select_on_container_copy_construction() const {
+    return recycling_allocator(_Traits::select_on_container_copy_construction(__alloc_));
+  }
+
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const _Alloc& upstream_allocator() const noexcept { return __alloc_; }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI size_t cached() const noexcept { return __cached_; }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const recycling_allocator_stats& stats() const noexcept { return __stats_; }
+
+private:
+  _LIBCPP_HIDE_FROM_ABI void __release() noexcept {
+    while (__free_ != nullptr) {
+      __free_node* __node = __free_;
+      __free_             = __node->__next_;
+      _Traits::deallocate(__alloc_, reinterpret_cast<_Tp*>(__node), 1);
+      ++__stats_.released;
+    }
+    __cached_ = 0;
+  }
+
+  _LIBCPP_NO_UNIQUE_ADDRESS _Alloc __alloc_;
+  __free_node* __free_ = nullptr;
+  size_t __cached_     = 0;
+  recycling_allocator_stats __stats_;
+};
+
+template <class _Tp, class _Up, size_t _Capacity, class _Alloc, class _UpAlloc>
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI bool operator==(const recycling_allocator<_Tp, _Capacity, _Alloc>& __x,
+                                                    const recycling_allocator<_Up, _Capacity, _UpAlloc>& __y) noexcept {
+  return __x.upstream_allocator() == __y.upstream_allocator();
+}
+
+#  if _LIBCPP_STD_VER <= 17
+template <class _Tp, class _Up, size_t _Capacity, class _Alloc, class _UpAlloc>
+[[nodiscard]] _LIBCPP_HIDE_FROM_ABI bool operator!=(const recycling_allocator<_Tp, _Capacity, _Alloc>& __x,
+                                                    const recycling_allocator<_Up, _Capacity, _UpAlloc>& __y) noexcept {
+  return !(__x == __y);
+}
+#  endif
+
+#endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_NODE_RECYCLING
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MEMORY_RECYCLING_ALLOCATOR_H
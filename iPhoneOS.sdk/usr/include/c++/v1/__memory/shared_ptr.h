@@ -92,6 +92,9 @@ public:
 template <class _Tp>
 class weak_ptr;
 
+template <class _SmartPtr, bool _IsWeak>
+struct __atomic_smart_ptr;
+
 template <class _Tp, class _Dp, class _Alloc>
 class __shared_ptr_pointer : public __shared_weak_count {
   _LIBCPP_COMPRESSED_TRIPLE(_Tp, __ptr_, _Dp, __deleter_, _Alloc, __alloc_);
@@ -716,6 +719,8 @@ private:
   friend class shared_ptr;
   template <class _Up>
   friend class weak_ptr;
+  template <class _SmartPtr, bool _IsWeak>
+  friend struct __atomic_smart_ptr;
 };
 
 #if _LIBCPP_STD_VER >= 17
@@ -1269,6 +1274,8 @@ public:
   friend class weak_ptr;
   template <class _Up>
   friend class shared_ptr;
+  template <class _SmartPtr, bool _IsWeak>
+  friend struct __atomic_smart_ptr;
 };
 
 #if _LIBCPP_STD_VER >= 17
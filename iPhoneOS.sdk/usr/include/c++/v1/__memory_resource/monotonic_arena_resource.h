@@ -0,0 +1,235 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MEMORY_RESOURCE_MONOTONIC_ARENA_RESOURCE_H
+#define _LIBCPP___MEMORY_RESOURCE_MONOTONIC_ARENA_RESOURCE_H
+
+#include <__assert>
+#include <__config>
+#include <__cstddef/max_align_t.h>
+#include <__cstddef/size_t.h>
+#include <__memory/addressof.h>
+#include <__memory_resource/memory_resource.h>
+#include <__new/exceptions.h>
+#include <__new/placement_new_delete.h>
+#include <cstdint>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+#if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_MONOTONIC_ARENA
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+namespace pmr {
+
+struct arena_options {
+  size_t initial_chunk_size = 1024;
+  size_t max_chunk_size     = 0; // 0 means no limit
+  size_t growth_factor      = 2; // 1 allocates chunks of a constant size
+};
+
+// A monotonic_buffer_resource that can be rewound.
+//
+// monotonic_buffer_resource can only give its memory back all at once, and
+// then returns every chunk to the upstream resource. This resource hands out
+// memory the same way, but also supports
+//  - mark() and rewind(), which free everything allocated after a checkpoint,
+//  - a geometric growth policy with a configurable factor and upper bound, and
+//  - keeping the chunks freed by rewind() and release() to serve later
+//    allocations, so that an arena used over and over again, for instance one
+//    per worker thread, stops going to the upstream resource once it is warm.
+// Retained chunks are only given back by shrink_to_fit() and the destructor.
+//
+// It is header-only, since the layout of monotonic_buffer_resource and its
+// do_allocate are part of the ABI.
+class _LIBCPP_AVAILABILITY_PMR monotonic_arena_resource : public memory_resource {
+  struct __chunk {
+    __chunk* __next_;
+    size_t __size_;
+  };
+
+  static constexpr size_t __chunk_align = alignof(max_align_t);
+  static constexpr size_t __header_size = (sizeof(__chunk) + __chunk_align - 1) & ~(__chunk_align - 1);
+  static constexpr size_t __no_limit    = ~size_t(0);
+
+public:
+  class checkpoint {
+    friend class monotonic_arena_resource;
+
+    __chunk* __chunk_;
+    char* __cur_;
+
+    _LIBCPP_HIDE_FROM_ABI checkpoint(__chunk* __c, char* __cur) _NOEXCEPT : __chunk_(__c), __cur_(__cur) {}
+  };
+
+  _LIBCPP_HIDE_FROM_ABI monotonic_arena_resource()
+      : monotonic_arena_resource(nullptr, 0, arena_options(), get_default_resource()) {}
+
+  _LIBCPP_HIDE_FROM_ABI explicit monotonic_arena_resource(memory_resource* __upstream)
+      : monotonic_arena_resource(nullptr, 0, arena_options(), __upstream) {}
+
+  _LIBCPP_HIDE_FROM_ABI explicit monotonic_arena_resource(const arena_options& __opts)
+      : monotonic_arena_resource(nullptr, 0, __opts, get_default_resource()) {}
+
+  _LIBCPP_HIDE_FROM_ABI monotonic_arena_resource(const arena_options& __opts, memory_resource* __upstream)
+      : monotonic_arena_resource(nullptr, 0, __opts, __upstream) {}
+
+  _LIBCPP_HIDE_FROM_ABI monotonic_arena_resource(void* __buffer, size_t __buffer_size)
+      : monotonic_arena_resource(__buffer, __buffer_size, arena_options(), get_default_resource()) {}
+
+  _LIBCPP_HIDE_FROM_ABI monotonic_arena_resource(void* __buffer, size_t __buffer_size, memory_resource* __upstream)
+      : monotonic_arena_resource(__buffer, __buffer_size, arena_options(), __upstream) {}
+
+  _LIBCPP_HIDE_FROM_ABI monotonic_arena_resource(
+      void* __buffer, size_t __buffer_size, const arena_options& __opts, memory_resource* __upstream)
+      : __opts_(__opts),
+        __res_(__upstream),
+        __active_(nullptr),
+        __retained_(nullptr),
+        __buffer_(static_cast<char*>(__buffer)),
+        __buffer_end_(__buffer != nullptr ? static_cast<char*>(__buffer) + __buffer_size : nullptr),
+        __cur_(__buffer_),
+        __end_(__buffer_end_),
+        __footprint_(0) {
+    if (__opts_.max_chunk_size == 0)
+      __opts_.max_chunk_size = __no_limit;
+    if (__opts_.growth_factor == 0)
+      __opts_.growth_factor = 1;
+    if (__opts_.initial_chunk_size == 0)
+      __opts_.initial_chunk_size = arena_options().initial_chunk_size;
+    if (__opts_.initial_chunk_size > __opts_.max_chunk_size)
+      __opts_.initial_chunk_size = __opts_.max_chunk_size;
+    __next_size_ = __opts_.initial_chunk_size;
+  }
+
+  monotonic_arena_resource(const monotonic_arena_resource&)            = delete;
+  monotonic_arena_resource& operator=(const monotonic_arena_resource&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL ~monotonic_arena_resource() override {
+    release();
+    shrink_to_fit();
+  }
+
+  // Returns a checkpoint that rewind() can go back to. Rewinding to a
+  // checkpoint invalidates every checkpoint taken after it.
+  _LIBCPP_HIDE_FROM_ABI checkpoint mark() const _NOEXCEPT { return checkpoint(__active_, __cur_); }
+
+  // Frees everything allocated since __cp was taken. The chunks allocated since
+  // then are kept for reuse.
+  _LIBCPP_HIDE_FROM_ABI void rewind(checkpoint __cp) _NOEXCEPT {
+    while (__active_ != __cp.__chunk_) {
+      _LIBCPP_ASSERT_ARGUMENT_WITHIN_DOMAIN(
+          __active_ != nullptr, "monotonic_arena_resource::rewind: the checkpoint does not belong to this arena");
+      __chunk* __next    = __active_->__next_;
+      __active_->__next_ = __retained_;
+      __retained_        = __active_;
+      __active_          = __next;
+    }
+    __cur_ = __cp.__cur_;
+    __end_ = __active_ != nullptr ? reinterpret_cast<char*>(__active_) + __active_->__size_ : __buffer_end_;
+  }
+
+  // Frees everything allocated so far, keeping the chunks for reuse.
+  _LIBCPP_HIDE_FROM_ABI void release() _NOEXCEPT { rewind(checkpoint(nullptr, __buffer_)); }
+
+  // Returns the chunks kept for reuse to the upstream resource.
+  _LIBCPP_HIDE_FROM_ABI void shrink_to_fit() _NOEXCEPT {
+    while (__retained_ != nullptr) {
+      __chunk* __next = __retained_->__next_;
+      __footprint_ -= __retained_->__size_;
+      __res_->deallocate(__retained_, __retained_->__size_, __chunk_align);
+      __retained_ = __next;
+    }
+  }
+
+  // The number of bytes currently obtained from the upstream resource,
+  // including the chunks kept for reuse.
+  _LIBCPP_HIDE_FROM_ABI size_t footprint() const _NOEXCEPT { return __footprint_; }
+
+  _LIBCPP_HIDE_FROM_ABI arena_options options() const _NOEXCEPT { return __opts_; }
+
+  _LIBCPP_HIDE_FROM_ABI memory_resource* upstream_resource() const { return __res_; }
+
+protected:
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL void* do_allocate(size_t __bytes, size_t __alignment) override {
+    if (void* __result = __try_allocate(__bytes, __alignment))
+      return __result;
+    __add_chunk(__bytes, __alignment);
+    return __try_allocate(__bytes, __alignment);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL void do_deallocate(void*, size_t, size_t) override {}
+
+  _LIBCPP_HIDE_FROM_ABI_VIRTUAL bool do_is_equal(const memory_resource& __other) const _NOEXCEPT override {
+    return this == std::addressof(__other);
+  }
+
+private:
+  _LIBCPP_HIDE_FROM_ABI void* __try_allocate(size_t __bytes, size_t __alignment) _NOEXCEPT {
+    if (__cur_ == nullptr)
+      return nullptr;
+    size_t __padding   = -reinterpret_cast<uintptr_t>(__cur_) & (__alignment - 1);
+    size_t __available = static_cast<size_t>(__end_ - __cur_);
+    if (__padding > __available || __bytes > __available - __padding)
+      return nullptr;
+    char* __result = __cur_ + __padding;
+    __cur_         = __result + __bytes;
+    return __result;
+  }
+
+  // Makes a chunk that can hold __bytes aligned to __alignment the current one,
+  // reusing a retained chunk if one is large enough.
+  _LIBCPP_HIDE_FROM_ABI void __add_chunk(size_t __bytes, size_t __alignment) {
+    // The payload of a chunk is aligned to __chunk_align.
+    size_t __padding = __alignment > __chunk_align ? __alignment - __chunk_align : 0;
+    if (__bytes > __no_limit - __header_size - __padding)
+      std::__throw_bad_alloc();
+    size_t __needed = __header_size + __padding + __bytes;
+
+    __chunk** __link = &__retained_;
+    while (*__link != nullptr && (*__link)->__size_ < __needed)
+      __link = &(*__link)->__next_;
+
+    __chunk* __c = *__link;
+    if (__c != nullptr) {
+      *__link = __c->__next_;
+    } else {
+      size_t __size = __needed > __next_size_ ? __needed : __next_size_;
+      __c           = ::new (__res_->allocate(__size, __chunk_align)) __chunk{nullptr, __size};
+      __footprint_ += __size;
+      __next_size_ = __next_size_ <= __opts_.max_chunk_size / __opts_.growth_factor
+                       ? __next_size_ * __opts_.growth_factor
+                       : __opts_.max_chunk_size;
+    }
+    __c->__next_ = __active_;
+    __active_    = __c;
+    __cur_       = reinterpret_cast<char*>(__c) + __header_size;
+    __end_       = reinterpret_cast<char*>(__c) + __c->__size_;
+  }
+
+  arena_options __opts_;
+  memory_resource* __res_;
+  __chunk* __active_;   // the chunks in use, most recent first
+  __chunk* __retained_; // the chunks kept for reuse
+  char* __buffer_;
+  char* __buffer_end_;
+  char* __cur_;
+  char* __end_;
+  size_t __next_size_;
+  size_t __footprint_;
+};
+
+} // namespace pmr
+
+_LIBCPP_END_NAMESPACE_STD
+
+#endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_MONOTONIC_ARENA
+
+#endif // _LIBCPP___MEMORY_RESOURCE_MONOTONIC_ARENA_RESOURCE_H
@@ -0,0 +1,154 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___MUTEX_SCALABLE_SHARED_MUTEX_H
+#define _LIBCPP___MUTEX_SCALABLE_SHARED_MUTEX_H
+
+#include <__atomic/atomic.h>
+#include <__atomic/memory_order.h>
+#include <__config>
+#include <__cstddef/size_t.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_SCALABLE_SHARED_MUTEX
+
+// A reader-writer lock for read-mostly data.
+//
+// shared_mutex counts its readers in a single word, so every lock_shared and
+// unlock_shared writes to the same cache line and read-side throughput drops
+// as cores are added. Here readers are spread over __slot_count counters, each
+// on its own cache line, and a thread always uses the same counter. A reader
+// announces itself in its counter and then checks the writer flag; a writer
+// sets the flag and then waits for every counter to drain. Readers that find
+// the flag set step back and wait for the writer to leave, so a waiting writer
+// is never starved by a stream of new readers.
+//
+// All the blocking is done with atomic::wait, which only goes to the kernel
+// when the lock is contended. Uncontended lock_shared and unlock_shared are a
+// single atomic operation on a thread-private cache line plus a load of a
+// read-shared one.
+//
+// The price is the size. The writer flag and each of the 32 counters take a
+// cache line of their own, of at most 128 bytes, so the mutex takes about
+// 4 KiB, or about 2 KiB on targets with 64 byte lines.
+class _LIBCPP_CAPABILITY("shared_mutex") scalable_shared_mutex {
+  // __GCC_DESTRUCTIVE_SIZE is 256 on arm64, to be safe on every core, which
+  // would double the size of the mutex. The cache lines of the arm64 cores in
+  // use are at most 128 bytes.
+#  if defined(__GCC_DESTRUCTIVE_SIZE)
+  static constexpr size_t __line_size = __GCC_DESTRUCTIVE_SIZE < 128 ? __GCC_DESTRUCTIVE_SIZE : 128;
+#  else
+  static constexpr size_t __line_size = 64;
+#  endif
+  static constexpr size_t __slot_count = 32;
+
+  struct alignas(__line_size) __slot {
+    atomic<long> __readers_{0};
+  };
+
+  alignas(__line_size) atomic<bool> __writer_{false};
+  __slot __slots_[__slot_count];
+
+  _LIBCPP_HIDE_FROM_ABI static size_t __this_slot() _NOEXCEPT {
+    _LIBCPP_CONSTINIT static atomic<size_t> __next_slot{0};
+    static thread_local size_t __slot = __next_slot.fetch_add(1, memory_order_relaxed) % __slot_count;
+    return __slot;
+  }
+
+  // Announces a reader in __s. Fails, without blocking, if a writer holds or
+  // waits for the lock. The counters and the writer flag are accessed with
+  // sequentially consistent operations, so that a reader incrementing its
+  // counter and a writer setting the flag cannot both miss each other.
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI bool __try_enter(__slot& __s) _NOEXCEPT {
+    __s.__readers_.fetch_add(1);
+    if (!__writer_.load())
+      return true;
+    __leave(__s);
+    return false;
+  }
+
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void __leave(__slot& __s) _NOEXCEPT {
+    if (__s.__readers_.fetch_sub(1) == 1 && __writer_.load())
+      __s.__readers_.notify_all();
+  }
+
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void __wait_for_readers() _NOEXCEPT {
+    for (__slot& __s : __slots_) {
+      for (long __n = __s.__readers_.load(); __n != 0; __n = __s.__readers_.load())
+        __s.__readers_.wait(__n);
+    }
+  }
+
+  _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI bool __has_readers() const _NOEXCEPT {
+    for (const __slot& __s : __slots_) {
+      if (__s.__readers_.load() != 0)
+        return true;
+    }
+    return false;
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI constexpr scalable_shared_mutex() _NOEXCEPT = default;
+  _LIBCPP_HIDE_FROM_ABI ~scalable_shared_mutex()                     = default;
+
+  scalable_shared_mutex(const scalable_shared_mutex&)            = delete;
+  scalable_shared_mutex& operator=(const scalable_shared_mutex&) = delete;
+
+  // Exclusive ownership
+  _LIBCPP_ACQUIRE_CAPABILITY() _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void lock() {
+    while (__writer_.exchange(true))
+      __writer_.wait(true, memory_order_relaxed);
+    __wait_for_readers();
+  }
+
+  _LIBCPP_TRY_ACQUIRE_CAPABILITY(true) _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI bool try_lock() {
+    if (__writer_.exchange(true))
+      return false;
+    if (!__has_readers())
+      return true;
+    unlock();
+    return false;
+  }
+
+  _LIBCPP_RELEASE_CAPABILITY _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void unlock() {
+    __writer_.store(false, memory_order_release);
+    __writer_.notify_all();
+  }
+
+  // Shared ownership
+  _LIBCPP_ACQUIRE_SHARED_CAPABILITY _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void lock_shared() {
+    __slot& __s = __slots_[__this_slot()];
+    while (!__try_enter(__s))
+      __writer_.wait(true, memory_order_relaxed);
+  }
+
+  _LIBCPP_TRY_ACQUIRE_SHARED_CAPABILITY(true) _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI bool try_lock_shared() {
+    return __try_enter(__slots_[__this_slot()]);
+  }
+
+  _LIBCPP_RELEASE_SHARED_CAPABILITY _LIBCPP_AVAILABILITY_SYNC _LIBCPP_HIDE_FROM_ABI void unlock_shared() {
+    __leave(__slots_[__this_slot()]);
+  }
+};
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_SCALABLE_SHARED_MUTEX
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___MUTEX_SCALABLE_SHARED_MUTEX_H
@@ -0,0 +1,443 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___RANGES_CARTESIAN_PRODUCT_VIEW_H
+#define _LIBCPP___RANGES_CARTESIAN_PRODUCT_VIEW_H
+
+#include <__config>
+
+#include <__compare/three_way_comparable.h>
+#include <__concepts/constructible.h>
+#include <__concepts/convertible_to.h>
+#include <__concepts/equality_comparable.h>
+#include <__cstddef/ptrdiff_t.h>
+#include <__cstddef/size_t.h>
+#include <__iterator/concepts.h>
+#include <__iterator/default_sentinel.h>
+#include <__iterator/distance.h>
+#include <__iterator/iter_move.h>
+#include <__iterator/iter_swap.h>
+#include <__iterator/iterator_traits.h>
+#include <__memory/addressof.h>
+#include <__ranges/access.h>
+#include <__ranges/all.h>
+#include <__ranges/concepts.h>
+#include <__ranges/empty.h>
+#include <__ranges/single_view.h>
+#include <__ranges/size.h>
+#include <__ranges/view_interface.h>
+#include <__ranges/zip_view.h>
+#include <__type_traits/common_type.h>
+#include <__type_traits/is_nothrow_constructible.h>
+#include <__type_traits/make_unsigned.h>
+#include <__type_traits/maybe_const.h>
+#include <__utility/forward.h>
+#include <__utility/integer_sequence.h>
+#include <__utility/move.h>
+#include <tuple>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 23
+
+namespace ranges {
+
+template <bool _Const, class _First, class... _Vs>
+concept __cartesian_product_is_random_access =
+    (random_access_range<__maybe_const<_Const, _First>> && ... &&
+     (random_access_range<__maybe_const<_Const, _Vs>> && sized_range<__maybe_const<_Const, _Vs>>));
+
+template <class _Range>
+concept __cartesian_product_common_arg = common_range<_Range> || (sized_range<_Range> && random_access_range<_Range>);
+
+template <bool _Const, class _First, class... _Vs>
+concept __cartesian_product_is_bidirectional =
+    (bidirectional_range<__maybe_const<_Const, _First>> && ... &&
+     (bidirectional_range<__maybe_const<_Const, _Vs>> && __cartesian_product_common_arg<__maybe_const<_Const, _Vs>>));
+
+template <class _First, class... _Vs>
+concept __cartesian_product_is_common = __cartesian_product_common_arg<_First>;
+
+template <class... _Vs>
+concept __cartesian_product_is_sized = (sized_range<_Vs> && ...);
+
+template <bool _Const, template <class> class _FirstSent, class _First, class... _Vs>
+concept __cartesian_is_sized_sentinel =
+    (sized_sentinel_for<_FirstSent<__maybe_const<_Const, _First>>, iterator_t<__maybe_const<_Const, _First>>> && ... &&
+     (sized_range<__maybe_const<_Const, _Vs>> &&
+      sized_sentinel_for<iterator_t<__maybe_const<_Const, _Vs>>, iterator_t<__maybe_const<_Const, _Vs>>>));
+
+template <__cartesian_product_common_arg _Range>
+_LIBCPP_HIDE_FROM_ABI constexpr auto __cartesian_common_arg_end(_Range& __r) {
+  if constexpr (common_range<_Range>)
+    return ranges::end(__r);
+  else
+    return ranges::begin(__r) + ranges::distance(__r);
+}
+
+template <input_range _First, forward_range... _Vs>
+  requires(view<_First> && ... && view<_Vs>)
+class cartesian_product_view : public view_interface<cartesian_product_view<_First, _Vs...>> {
+  _LIBCPP_NO_UNIQUE_ADDRESS tuple<_First, _Vs...> __bases_;
+
+  template <bool _Const>
+  class __iterator;
+
+public:
+  _LIBCPP_HIDE_FROM_ABI cartesian_product_view() = default;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr explicit cartesian_product_view(_First __first_base, _Vs... __bases)
+      : __bases_(std::move(__first_base), std::move(__bases)...) {}
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator<false> begin()
+    requires(!__simple_view<_First> || ... || !__simple_view<_Vs>)
+  {
+    return __iterator<false>(*this, ranges::__tuple_transform(ranges::begin, __bases_));
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator<true> begin() const
+    requires(range<const _First> && ... && range<const _Vs>)
+  {
+    return __iterator<true>(*this, ranges::__tuple_transform(ranges::begin, __bases_));
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator<false> end()
+    requires((!__simple_view<_First> || ... || !__simple_view<_Vs>) && __cartesian_product_is_common<_First, _Vs...>)
+  {
+    return __end<false>(*this);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator<true> end() const
+    requires __cartesian_product_is_common<const _First, const _Vs...>
+  {
+    return __end<true>(*this);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr default_sentinel_t end() const noexcept { return default_sentinel; }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr auto size()
+    requires __cartesian_product_is_sized<_First, _Vs...>
+  {
+    return __size(__bases_);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr auto size() const
+    requires __cartesian_product_is_sized<const _First, const _Vs...>
+  {
+    return __size(__bases_);
+  }
+
+private:
+  // The end is the first range's end followed by the other ranges' begins,
+  // unless one of the other ranges is empty, in which case it is the begin.
+  template <bool _Const, class _Self>
+  _LIBCPP_HIDE_FROM_ABI static constexpr __iterator<_Const> __end(_Self& __self) {
+    bool __is_empty =
+        std::apply([](auto&, auto&... __rest) { return (ranges::empty(__rest) || ...); }, __self.__bases_);
+    auto __current = ranges::__tuple_transform(ranges::begin, __self.__bases_);
+    if (!__is_empty)
+      std::get<0>(__current) = ranges::__cartesian_common_arg_end(std::get<0>(__self.__bases_));
+    return __iterator<_Const>(__self, std::move(__current));
+  }
+
+  template <class _Bases>
+  _LIBCPP_HIDE_FROM_ABI static constexpr auto __size(_Bases& __bases) {
+    return std::apply(
+        [](auto&... __rs) {
+          using _ST = common_type_t<size_t, make_unsigned_t<decltype(ranges::size(__rs))>...>;
+          return (static_cast<_ST>(ranges::size(__rs)) * ...);
+        },
+        __bases);
+  }
+};
+
+template <class... _Ranges>
+cartesian_product_view(_Ranges&&...) -> cartesian_product_view<views::all_t<_Ranges>...>;
+
+template <input_range _First, forward_range... _Vs>
+  requires(view<_First> && ... && view<_Vs>)
+template <bool _Const>
+class cartesian_product_view<_First, _Vs...>::__iterator {
+  template <bool>
+  friend class __iterator;
+
+  friend cartesian_product_view;
+
+  using _Parent _LIBCPP_NODEBUG = __maybe_const<_Const, cartesian_product_view>;
+
+  static consteval auto __get_iterator_concept() {
+    if constexpr (__cartesian_product_is_random_access<_Const, _First, _Vs...>) {
+      return random_access_iterator_tag{};
+    } else if constexpr (__cartesian_product_is_bidirectional<_Const, _First, _Vs...>) {
+      return bidirectional_iterator_tag{};
+    } else if constexpr (forward_range<__maybe_const<_Const, _First>>) {
+      return forward_iterator_tag{};
+    } else {
+      return input_iterator_tag{};
+    }
+  }
+
+public:
+  using iterator_category = input_iterator_tag;
+  using iterator_concept  = decltype(__get_iterator_concept());
+  using value_type = tuple<range_value_t<__maybe_const<_Const, _First>>, range_value_t<__maybe_const<_Const, _Vs>>...>;
+  using reference =
+      tuple<range_reference_t<__maybe_const<_Const, _First>>, range_reference_t<__maybe_const<_Const, _Vs>>...>;
+  using difference_type =
+      common_type_t<ptrdiff_t,
+                    range_difference_t<__maybe_const<_Const, _First>>,
+                    range_difference_t<__maybe_const<_Const, _Vs>>...>;
+
+private:
+  _Parent* __parent_ = nullptr;
+  tuple<iterator_t<__maybe_const<_Const, _First>>, iterator_t<__maybe_const<_Const, _Vs>>...> __current_;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator(
+      _Parent& __parent,
+      tuple<iterator_t<__maybe_const<_Const, _First>>, iterator_t<__maybe_const<_Const, _Vs>>...> __current)
+      : __parent_(std::addressof(__parent)), __current_(std::move(__current)) {}
+
+  // Increments the last iterator, and carries into the previous ones when it wraps around.
+  template <size_t _Np = sizeof...(_Vs)>
+  _LIBCPP_HIDE_FROM_ABI constexpr void __next() {
+    auto& __it = std::get<_Np>(__current_);
+    ++__it;
+    if constexpr (_Np > 0) {
+      if (__it == ranges::end(std::get<_Np>(__parent_->__bases_))) {
+        __it = ranges::begin(std::get<_Np>(__parent_->__bases_));
+        __next<_Np - 1>();
+      }
+    }
+  }
+
+  template <size_t _Np = sizeof...(_Vs)>
+  _LIBCPP_HIDE_FROM_ABI constexpr void __prev() {
+    auto& __it = std::get<_Np>(__current_);
+    if constexpr (_Np > 0) {
+      if (__it == ranges::begin(std::get<_Np>(__parent_->__bases_))) {
+        __it = ranges::__cartesian_common_arg_end(std::get<_Np>(__parent_->__bases_));
+        __prev<_Np - 1>();
+      }
+    }
+    --__it;
+  }
+
+  // Moves by __x positions in constant time, treating the iterators as the
+  // digits of a mixed-radix number whose radixes are the sizes of the ranges.
+  template <size_t _Np = sizeof...(_Vs)>
+  _LIBCPP_HIDE_FROM_ABI constexpr void __advance(difference_type __x) {
+    if (__x == 0)
+      return;
+    auto& __it = std::get<_Np>(__current_);
+    if constexpr (_Np == 0) {
+      __it += __x;
+    } else {
+      auto& __r                  = std::get<_Np>(__parent_->__bases_);
+      auto __first               = ranges::begin(__r);
+      const difference_type __sz = static_cast<difference_type>(ranges::size(__r));
+      difference_type __idx      = static_cast<difference_type>(__it - __first) + __x;
+      difference_type __carry    = __idx / __sz;
+      __idx %= __sz;
+      if (__idx < 0) {
+        __idx += __sz;
+        --__carry;
+      }
+      __it = __first + __idx;
+      __advance<_Np - 1>(__carry);
+    }
+  }
+
+  template <size_t _Np = 0, class _Tuple>
+  _LIBCPP_HIDE_FROM_ABI constexpr difference_type __distance_from(const _Tuple& __t, difference_type __sum = 0) const {
+    if constexpr (_Np > 0)
+      __sum *= static_cast<difference_type>(ranges::size(std::get<_Np>(__parent_->__bases_)));
+    __sum += static_cast<difference_type>(std::get<_Np>(__current_) - std::get<_Np>(__t));
+    if constexpr (_Np < sizeof...(_Vs))
+      return __distance_from<_Np + 1>(__t, __sum);
+    else
+      return __sum;
+  }
+
+  // The hidden friends below cannot access the private members of cartesian_product_view.
+  _LIBCPP_HIDE_FROM_ABI constexpr bool __at_end() const {
+    return [&]<size_t... _Is>(index_sequence<_Is...>) {
+      return ((std::get<_Is>(__current_) == ranges::end(std::get<_Is>(__parent_->__bases_))) || ...);
+    }(index_sequence_for<_First, _Vs...>());
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr difference_type __distance_to_end() const {
+    auto __end_tuple = [&]<size_t... _Is>(index_sequence<_Is...>) {
+      return tuple(ranges::end(std::get<0>(__parent_->__bases_)),
+                   ranges::begin(std::get<_Is + 1>(__parent_->__bases_))...);
+    }(index_sequence_for<_Vs...>());
+    return __distance_from(__end_tuple);
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI __iterator() = default;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator(__iterator<!_Const> __i)
+    requires _Const && (convertible_to<iterator_t<_First>, iterator_t<const _First>> && ... &&
+                        convertible_to<iterator_t<_Vs>, iterator_t<const _Vs>>)
+      : __parent_(__i.__parent_), __current_(std::move(__i.__current_)) {}
+
+  _LIBCPP_HIDE_FROM_ABI constexpr auto operator*() const {
+    return ranges::__tuple_transform([](auto& __i) -> decltype(auto) { return *__i; }, __current_);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator& operator++() {
+    __next();
+    return *this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr void operator++(int) { ++*this; }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator operator++(int)
+    requires forward_range<__maybe_const<_Const, _First>>
+  {
+    auto __tmp = *this;
+    ++*this;
+    return __tmp;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator& operator--()
+    requires __cartesian_product_is_bidirectional<_Const, _First, _Vs...>
+  {
+    __prev();
+    return *this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator operator--(int)
+    requires __cartesian_product_is_bidirectional<_Const, _First, _Vs...>
+  {
+    auto __tmp = *this;
+    --*this;
+    return __tmp;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator& operator+=(difference_type __x)
+    requires __cartesian_product_is_random_access<_Const, _First, _Vs...>
+  {
+    __advance(__x);
+    return *this;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr __iterator& operator-=(difference_type __x)
+    requires __cartesian_product_is_random_access<_Const, _First, _Vs...>
+  {
+    return *this += -__x;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI constexpr reference operator[](difference_type __n) const
+    requires __cartesian_product_is_random_access<_Const, _First, _Vs...>
+  {
+    return *((*this) + __n);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr bool operator==(const __iterator& __x, const __iterator& __y)
+    requires equality_comparable<iterator_t<__maybe_const<_Const, _First>>>
+  {
+    return __x.__current_ == __y.__current_;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr bool operator==(const __iterator& __x, default_sentinel_t) {
+    return __x.__at_end();
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr auto operator<=>(const __iterator& __x, const __iterator& __y)
+    requires(random_access_range<__maybe_const<_Const, _First>> && ... &&
+             random_access_range<__maybe_const<_Const, _Vs>>)
+  {
+    return __x.__current_ <=> __y.__current_;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr __iterator operator+(const __iterator& __x, difference_type __y)
+    requires __cartesian_product_is_random_access<_Const, _First, _Vs...>
+  {
+    return __iterator(__x) += __y;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr __iterator operator+(difference_type __x, const __iterator& __y)
+    requires __cartesian_product_is_random_access<_Const, _First, _Vs...>
+  {
+    return __y + __x;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr __iterator operator-(const __iterator& __x, difference_type __y)
+    requires __cartesian_product_is_random_access<_Const, _First, _Vs...>
+  {
+    return __iterator(__x) -= __y;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr difference_type operator-(const __iterator& __x, const __iterator& __y)
+    requires __cartesian_is_sized_sentinel<_Const, iterator_t, _First, _Vs...>
+  {
+    return __x.__distance_from(__y.__current_);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr difference_type operator-(const __iterator& __i, default_sentinel_t)
+    requires __cartesian_is_sized_sentinel<_Const, sentinel_t, _First, _Vs...>
+  {
+    return __i.__distance_to_end();
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr difference_type operator-(default_sentinel_t __s, const __iterator& __i)
+    requires __cartesian_is_sized_sentinel<_Const, sentinel_t, _First, _Vs...>
+  {
+    return -(__i - __s);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr auto iter_move(const __iterator& __i) {
+    return ranges::__tuple_transform(ranges::iter_move, __i.__current_);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI friend constexpr void iter_swap(const __iterator& __l, const __iterator& __r)
+    requires(indirectly_swappable<iterator_t<__maybe_const<_Const, _First>>> && ... &&
+             indirectly_swappable<iterator_t<__maybe_const<_Const, _Vs>>>)
+  {
+    ranges::__tuple_zip_for_each(ranges::iter_swap, __l.__current_, __r.__current_);
+  }
+};
+
+namespace views {
+namespace __cartesian_product {
+
+struct __fn {
+  _LIBCPP_HIDE_FROM_ABI static constexpr auto operator()() noexcept { return views::single(tuple()); }
+
+  template <class... _Ranges>
+  _LIBCPP_HIDE_FROM_ABI static constexpr auto operator()(_Ranges&&... __rs) noexcept(
+      noexcept(cartesian_product_view<all_t<_Ranges&&>...>(std::forward<_Ranges>(__rs)...)))
+      -> decltype(cartesian_product_view<all_t<_Ranges&&>...>(std::forward<_Ranges>(__rs)...)) {
+    return cartesian_product_view<all_t<_Ranges&&>...>(std::forward<_Ranges>(__rs)...);
+  }
+};
+
+} // namespace __cartesian_product
+
+inline namespace __cpo {
+inline constexpr auto cartesian_product = __cartesian_product::__fn{};
+} // namespace __cpo
+} // namespace views
+} // namespace ranges
+
+#endif // _LIBCPP_STD_VER >= 23
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___RANGES_CARTESIAN_PRODUCT_VIEW_H
@@ -0,0 +1,256 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___RCU_RCU_DOMAIN_H
+#define _LIBCPP___RCU_RCU_DOMAIN_H
+
+#include <__atomic/atomic.h>
+#include <__atomic/memory_order.h>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__mutex/lock_guard.h>
+#include <__mutex/mutex.h>
+#include <__thread/support.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_RCU
+
+class rcu_domain;
+
+_LIBCPP_HIDE_FROM_ABI rcu_domain& rcu_default_domain() _NOEXCEPT;
+
+// The intrusive part of an object retired to an rcu_domain. It is the private
+// base of rcu_obj_base and the header of the nodes allocated by rcu_retire.
+struct __rcu_node {
+  __rcu_node* __rcu_next_;
+  void (*__rcu_reclaim_)(__rcu_node*) _NOEXCEPT;
+};
+
+// The implementation follows the "memory barrier" flavour of userspace RCU.
+//
+// Every thread that enters a critical section registers a reader with the
+// domain. Its counter holds the nesting depth in the low bits and, in the top
+// bit, the phase of the domain when the outermost critical section started.
+// A grace period flips the phase of the domain twice, and after each flip waits
+// for the readers that are still inside a critical section started in the old
+// phase. Entering and leaving a critical section therefore only touch memory
+// owned by the current thread.
+//
+// Retired objects go to a list owned by the retiring thread. Once that list
+// holds __batch_size objects, the thread waits for a single grace period and
+// reclaims the whole batch, so the cost of a grace period is amortized over
+// many retirements. Lists of exiting threads are handed over to the domain
+// and reclaimed along with the next batch.
+class rcu_domain {
+  static constexpr unsigned long __phase_bit = ~(~0ul >> 1);
+  static constexpr unsigned long __nest_mask = __phase_bit - 1;
+  static constexpr size_t __batch_size       = 128;
+  static constexpr int __spin_count          = 64;
+
+  struct __reader {
+    rcu_domain& __dom_;
+    atomic<unsigned long> __ctr_;
+    atomic<__rcu_node*> __retired_;
+    size_t __retired_count_;
+    __reader* __prev_;
+    __reader* __next_;
+
+    _LIBCPP_HIDE_FROM_ABI explicit __reader(rcu_domain& __dom)
+        : __dom_(__dom), __ctr_(0), __retired_(nullptr), __retired_count_(0), __prev_(nullptr) {
+      lock_guard<mutex> __lock(__dom_.__mutex_);
+      __next_ = __dom_.__readers_;
+      if (__next_ != nullptr)
+        __next_->__prev_ = this;
+      __dom_.__readers_ = this;
+    }
+
+    _LIBCPP_HIDE_FROM_ABI ~__reader() {
+      {
+        lock_guard<mutex> __lock(__dom_.__mutex_);
+        if (__prev_ != nullptr)
+          __prev_->__next_ = __next_;
+        else
+          __dom_.__readers_ = __next_;
+        if (__next_ != nullptr)
+          __next_->__prev_ = __prev_;
+      }
+      __dom_.__push_orphans(__retired_.exchange(nullptr, memory_order_acquire));
+    }
+
+    __reader(const __reader&)            = delete;
+    __reader& operator=(const __reader&) = delete;
+  };
+
+  mutex __mutex_; // protects __readers_ and serializes grace periods
+  __reader* __readers_;
+  atomic<unsigned long> __gp_ctr_;
+  atomic<__rcu_node*> __orphans_;
+  atomic<long> __reclaiming_;
+
+  _LIBCPP_HIDE_FROM_ABI constexpr rcu_domain() _NOEXCEPT
+      : __readers_(nullptr), __gp_ctr_(1), __orphans_(nullptr), __reclaiming_(0) {}
+
+  friend rcu_domain& rcu_default_domain() _NOEXCEPT;
+
+  template <class _Pred>
+  _LIBCPP_HIDE_FROM_ABI static void __spin_until(_Pred __pred) _NOEXCEPT {
+    for (int __i = 0; !__pred(); ++__i) {
+      if (__i >= __spin_count)
+        std::__libcpp_thread_yield();
+    }
+  }
+
+  _LIBCPP_HIDE_FROM_ABI __reader& __this_reader() _NOEXCEPT {
+    static thread_local __reader __r(*this);
+    return __r;
+  }
+
+  // Returns the concatenation of __first and __second.
+  _LIBCPP_HIDE_FROM_ABI static __rcu_node* __splice(__rcu_node* __first, __rcu_node* __second) _NOEXCEPT {
+    if (__first == nullptr)
+      return __second;
+    __rcu_node* __last = __first;
+    while (__last->__rcu_next_ != nullptr)
+      __last = __last->__rcu_next_;
+    __last->__rcu_next_ = __second;
+    return __first;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __push_orphans(__rcu_node* __list) _NOEXCEPT {
+    if (__list == nullptr)
+      return;
+    __rcu_node* __last = __list;
+    while (__last->__rcu_next_ != nullptr)
+      __last = __last->__rcu_next_;
+    __rcu_node* __head = __orphans_.load(memory_order_relaxed);
+    do
+      __last->__rcu_next_ = __head;
+    while (!__orphans_.compare_exchange_weak(__head, __list, memory_order_release, memory_order_relaxed));
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static void __reclaim(__rcu_node* __list) _NOEXCEPT {
+    while (__list != nullptr) {
+      __rcu_node* __next = __list->__rcu_next_;
+      __list->__rcu_reclaim_(__list);
+      __list = __next;
+    }
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool __in_old_phase(const __reader& __r) const _NOEXCEPT {
+    unsigned long __ctr = __r.__ctr_.load(memory_order_acquire);
+    return (__ctr & __nest_mask) != 0 && ((__ctr ^ __gp_ctr_.load(memory_order_relaxed)) & __phase_bit) != 0;
+  }
+
+  // Waits for a grace period. Requires __mutex_ to be held.
+  _LIBCPP_HIDE_FROM_ABI void __wait_for_readers() _NOEXCEPT {
+    std::atomic_thread_fence(memory_order_seq_cst);
+    for (int __flip = 0; __flip != 2; ++__flip) {
+      __gp_ctr_.store(__gp_ctr_.load(memory_order_relaxed) ^ __phase_bit, memory_order_relaxed);
+      std::atomic_thread_fence(memory_order_seq_cst);
+      for (__reader* __r = __readers_; __r != nullptr; __r = __r->__next_)
+        __spin_until([this, __r] { return !__in_old_phase(*__r); });
+    }
+    std::atomic_thread_fence(memory_order_seq_cst);
+  }
+
+public:
+  rcu_domain(const rcu_domain&)            = delete;
+  rcu_domain& operator=(const rcu_domain&) = delete;
+
+  _LIBCPP_HIDE_FROM_ABI void lock() _NOEXCEPT {
+    __reader& __r     = __this_reader();
+    unsigned long __c = __r.__ctr_.load(memory_order_relaxed);
+    if ((__c & __nest_mask) == 0) {
+      __r.__ctr_.store(__gp_ctr_.load(memory_order_relaxed), memory_order_relaxed);
+      std::atomic_thread_fence(memory_order_seq_cst);
+    } else
+      __r.__ctr_.store(__c + 1, memory_order_relaxed);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI bool try_lock() _NOEXCEPT {
+    lock();
+    return true;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void unlock() _NOEXCEPT {
+    __reader& __r = __this_reader();
+    __r.__ctr_.store(__r.__ctr_.load(memory_order_relaxed) - 1, memory_order_release);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __retire(__rcu_node* __node) _NOEXCEPT {
+    __reader& __r      = __this_reader();
+    __rcu_node* __head = __r.__retired_.load(memory_order_relaxed);
+    do
+      __node->__rcu_next_ = __head;
+    while (!__r.__retired_.compare_exchange_weak(__head, __node, memory_order_release, memory_order_relaxed));
+
+    // Reclamation waits for a grace period, which would never end if this
+    // thread were inside a critical section itself.
+    if (++__r.__retired_count_ < __batch_size || (__r.__ctr_.load(memory_order_relaxed) & __nest_mask) != 0)
+      return;
+    __r.__retired_count_ = 0;
+    __reclaiming_.fetch_add(1, memory_order_relaxed);
+    __rcu_node* __batch = __r.__retired_.exchange(nullptr, memory_order_acquire);
+    __batch             = __splice(__batch, __orphans_.exchange(nullptr, memory_order_acquire));
+    {
+      lock_guard<mutex> __lock(__mutex_);
+      __wait_for_readers();
+    }
+    __reclaim(__batch);
+    __reclaiming_.fetch_sub(1, memory_order_release);
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __synchronize() _NOEXCEPT {
+    lock_guard<mutex> __lock(__mutex_);
+    __wait_for_readers();
+  }
+
+  _LIBCPP_HIDE_FROM_ABI void __barrier() _NOEXCEPT {
+    __rcu_node* __batch;
+    {
+      lock_guard<mutex> __lock(__mutex_);
+      __batch = __orphans_.exchange(nullptr, memory_order_acquire);
+      for (__reader* __r = __readers_; __r != nullptr; __r = __r->__next_)
+        __batch = __splice(__r->__retired_.exchange(nullptr, memory_order_acquire), __batch);
+      __wait_for_readers();
+    }
+    __reclaim(__batch);
+    // Batches detached by other threads before this call are reclaimed by those threads.
+    __spin_until([this] { return __reclaiming_.load(memory_order_acquire) == 0; });
+  }
+};
+
+_LIBCPP_HIDE_FROM_ABI inline rcu_domain& rcu_default_domain() _NOEXCEPT {
+  _LIBCPP_NO_DESTROY static rcu_domain __domain;
+  return __domain;
+}
+
+_LIBCPP_HIDE_FROM_ABI inline void rcu_synchronize(rcu_domain& __dom = rcu_default_domain()) _NOEXCEPT {
+  __dom.__synchronize();
+}
+
+_LIBCPP_HIDE_FROM_ABI inline void rcu_barrier(rcu_domain& __dom = rcu_default_domain()) _NOEXCEPT {
+  __dom.__barrier();
+}
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_RCU
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___RCU_RCU_DOMAIN_H
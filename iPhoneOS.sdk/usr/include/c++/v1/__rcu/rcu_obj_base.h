@@ -0,0 +1,83 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___RCU_RCU_OBJ_BASE_H
+#define _LIBCPP___RCU_RCU_OBJ_BASE_H
+
+#include <__config>
+#include <__memory/unique_ptr.h>
+#include <__rcu/rcu_domain.h>
+#include <__utility/move.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_RCU
+
+template <class _Tp, class _Dp = default_delete<_Tp> >
+class rcu_obj_base : private __rcu_node {
+  _LIBCPP_NO_UNIQUE_ADDRESS _Dp __deleter_;
+
+  _LIBCPP_HIDE_FROM_ABI static void __reclaim(__rcu_node* __node) _NOEXCEPT {
+    rcu_obj_base* __self = static_cast<rcu_obj_base*>(__node);
+    _Dp __deleter        = std::move(__self->__deleter_);
+    __deleter(static_cast<_Tp*>(__self));
+  }
+
+public:
+  _LIBCPP_HIDE_FROM_ABI void retire(_Dp __d = _Dp(), rcu_domain& __dom = rcu_default_domain()) _NOEXCEPT {
+    __deleter_     = std::move(__d);
+    __rcu_reclaim_ = &__reclaim;
+    __dom.__retire(this);
+  }
+
+protected:
+  _LIBCPP_HIDE_FROM_ABI rcu_obj_base()                               = default;
+  _LIBCPP_HIDE_FROM_ABI rcu_obj_base(const rcu_obj_base&)            = default;
+  _LIBCPP_HIDE_FROM_ABI rcu_obj_base(rcu_obj_base&&)                 = default;
+  _LIBCPP_HIDE_FROM_ABI rcu_obj_base& operator=(const rcu_obj_base&) = default;
+  _LIBCPP_HIDE_FROM_ABI rcu_obj_base& operator=(rcu_obj_base&&)      = default;
+  _LIBCPP_HIDE_FROM_ABI ~rcu_obj_base()                              = default;
+};
+
+// The node rcu_retire allocates for objects that do not derive from rcu_obj_base.
+template <class _Tp, class _Dp>
+struct __rcu_retired_ptr : __rcu_node {
+  _Tp* __ptr_;
+  _LIBCPP_NO_UNIQUE_ADDRESS _Dp __deleter_;
+
+  _LIBCPP_HIDE_FROM_ABI __rcu_retired_ptr(_Tp* __p, _Dp&& __d) : __ptr_(__p), __deleter_(std::move(__d)) {
+    __rcu_reclaim_ = &__reclaim;
+  }
+
+  _LIBCPP_HIDE_FROM_ABI static void __reclaim(__rcu_node* __node) _NOEXCEPT {
+    __rcu_retired_ptr* __self = static_cast<__rcu_retired_ptr*>(__node);
+    __self->__deleter_(__self->__ptr_);
+    delete __self;
+  }
+};
+
+template <class _Tp, class _Dp = default_delete<_Tp> >
+_LIBCPP_HIDE_FROM_ABI void rcu_retire(_Tp* __p, _Dp __d = _Dp(), rcu_domain& __dom = rcu_default_domain()) {
+  __dom.__retire(new __rcu_retired_ptr<_Tp, _Dp>(__p, std::move(__d)));
+}
+
+#endif // _LIBCPP_STD_VER >= 20 && _LIBCPP_HAS_THREADS && _LIBCPP_HAS_EXPERIMENTAL_RCU
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___RCU_RCU_OBJ_BASE_H
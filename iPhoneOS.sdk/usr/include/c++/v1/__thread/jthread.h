@@ -16,6 +16,7 @@
 #include <__thread/id.h>
 #include <__thread/support.h>
 #include <__thread/thread.h>
+#include <__thread/thread_attributes.h>
 #include <__type_traits/decay.h>
 #include <__type_traits/invoke.h>
 #include <__type_traits/is_constructible.h>
@@ -50,7 +51,7 @@ public:
 
   template <class _Fun, class... _Args>
   _LIBCPP_HIDE_FROM_ABI explicit jthread(_Fun&& __fun, _Args&&... __args)
-    requires(!std::is_same_v<remove_cvref_t<_Fun>, jthread>)
+    requires(!std::is_same_v<remove_cvref_t<_Fun>, jthread> && !__is_thread_attributes<remove_cvref_t<_Fun>>::value)
       : __stop_source_(),
         __thread_(__init_thread(__stop_source_, std::forward<_Fun>(__fun), std::forward<_Args>(__args)...)) {
     static_assert(is_constructible_v<decay_t<_Fun>, _Fun>);
@@ -59,6 +60,18 @@ public:
                   is_invocable_v<decay_t<_Fun>, stop_token, decay_t<_Args>...>);
   }
 
+#  if _LIBCPP_HAS_EXPERIMENTAL_THREAD_ATTRIBUTES
+  template <class _Fun, class... _Args>
+  _LIBCPP_HIDE_FROM_ABI explicit jthread(const thread_attributes& __attrs, _Fun&& __fun, _Args&&... __args)
+      : __stop_source_(),
+        __thread_(__init_thread(__attrs, __stop_source_, std::forward<_Fun>(__fun), std::forward<_Args>(__args)...)) {
+    static_assert(is_constructible_v<decay_t<_Fun>, _Fun>);
+    static_assert((is_constructible_v<decay_t<_Args>, _Args> && ...));
+    static_assert(is_invocable_v<decay_t<_Fun>, decay_t<_Args>...> ||
+                  is_invocable_v<decay_t<_Fun>, stop_token, decay_t<_Args>...>);
+  }
+#  endif
+
   _LIBCPP_HIDE_FROM_ABI ~jthread() {
     if (joinable()) {
       request_stop();
@@ -126,6 +139,18 @@ private:
     }
   }
 
+#  if _LIBCPP_HAS_EXPERIMENTAL_THREAD_ATTRIBUTES
+  template <class _Fun, class... _Args>
+  _LIBCPP_HIDE_FROM_ABI static thread
+  __init_thread(const thread_attributes& __attrs, const stop_source& __ss, _Fun&& __fun, _Args&&... __args) {
+    if constexpr (is_invocable_v<decay_t<_Fun>, stop_token, decay_t<_Args>...>) {
+      return thread(__attrs, std::forward<_Fun>(__fun), __ss.get_token(), std::forward<_Args>(__args)...);
+    } else {
+      return thread(__attrs, std::forward<_Fun>(__fun), std::forward<_Args>(__args)...);
+    }
+  }
+#  endif
+
   stop_source __stop_source_;
   thread __thread_;
 
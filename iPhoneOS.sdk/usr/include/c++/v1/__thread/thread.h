@@ -23,6 +23,7 @@
 #include <__system_error/throw_system_error.h>
 #include <__thread/id.h>
 #include <__thread/support.h>
+#include <__thread/thread_attributes.h>
 #include <__type_traits/decay.h>
 #include <__type_traits/enable_if.h>
 #include <__type_traits/is_same.h>
@@ -207,7 +208,11 @@ public:
   _LIBCPP_HIDE_FROM_ABI thread() _NOEXCEPT : __t_(_LIBCPP_NULL_THREAD) {}
 
 #  ifndef _LIBCPP_CXX03_LANG
-  template <class _Fp, class... _Args, __enable_if_t<!is_same<__remove_cvref_t<_Fp>, thread>::value, int> = 0>
+  template <class _Fp,
+            class... _Args,
+            __enable_if_t<!is_same<__remove_cvref_t<_Fp>, thread>::value &&
+                              !__is_thread_attributes<__remove_cvref_t<_Fp> >::value,
+                          int> = 0>
   _LIBCPP_HIDE_FROM_ABI explicit thread(_Fp&& __f, _Args&&... __args) {
     typedef unique_ptr<__thread_struct> _TSPtr;
     _TSPtr __tsp(new __thread_struct);
@@ -219,6 +224,23 @@ public:
     else
       __throw_system_error(__ec, "thread constructor failed");
   }
+
+#    if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_THREAD_ATTRIBUTES
+  template <class _Fp, class... _Args>
+  _LIBCPP_HIDE_FROM_ABI explicit thread(const thread_attributes& __attrs, _Fp&& __f, _Args&&... __args) {
+    typedef unique_ptr<__thread_struct> _TSPtr;
+    _TSPtr __tsp(new __thread_struct);
+    typedef tuple<_TSPtr, __named_thread_function<__decay_t<_Fp> >, __decay_t<_Args>...> _Gp;
+    unique_ptr<_Gp> __p(new _Gp(std::move(__tsp),
+                                __named_thread_function<__decay_t<_Fp> >(__attrs, std::forward<_Fp>(__f)),
+                                std::forward<_Args>(__args)...));
+    int __ec = __attrs.__create_thread(&__t_, std::addressof(__thread_proxy<_Gp>), __p.get());
+    if (__ec == 0)
+      __p.release();
+    else
+      __throw_system_error(__ec, "thread constructor failed");
+  }
+#    endif
 #  else // _LIBCPP_CXX03_LANG
   template <class _Fp>
   _LIBCPP_HIDE_FROM_ABI explicit thread(_Fp __f) {
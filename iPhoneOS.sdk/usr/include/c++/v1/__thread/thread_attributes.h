@@ -0,0 +1,216 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCPP___THREAD_THREAD_ATTRIBUTES_H
+#define _LIBCPP___THREAD_THREAD_ATTRIBUTES_H
+
+#include <__assert>
+#include <__config>
+#include <__cstddef/size_t.h>
+#include <__functional/invoke.h>
+#include <__thread/support.h>
+#include <__type_traits/integral_constant.h>
+#include <__utility/forward.h>
+#include <__utility/move.h>
+#include <cstdint>
+#include <errno.h>
+
+#if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
+#  pragma GCC system_header
+#endif
+
+_LIBCPP_PUSH_MACROS
+#include <__undef_macros>
+
+_LIBCPP_BEGIN_NAMESPACE_STD
+
+#if _LIBCPP_HAS_THREADS
+
+template <class _Tp>
+struct __is_thread_attributes : false_type {};
+
+#  if _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_THREAD_ATTRIBUTES
+
+// The attributes of a thread which have to be set when it is created: the size of its stack, the CPUs it may run on,
+// its scheduling policy and priority, and its name. A thread_attributes is passed as the first argument of the
+// constructors of thread and jthread, and the thread starts running the function with all of them applied. If one of
+// them cannot be applied, the constructor throws a system_error like it does when the thread cannot be created.
+//
+// With pthreads, the stack size, the scheduling and, with glibc, the affinity are set through the pthread_attr_t the
+// thread is created with. The affinity is not supported on other platforms. The name is set by the thread itself
+// before it calls the function, and is truncated to what the platform supports.
+class thread_attributes {
+public:
+  static constexpr size_t max_cpus      = 1024;
+  static constexpr size_t max_name_size = 63;
+
+  _LIBCPP_HIDE_FROM_ABI thread_attributes() noexcept = default;
+
+  // A stack size of 0 is the default stack size of the platform.
+  _LIBCPP_HIDE_FROM_ABI thread_attributes& set_stack_size(size_t __size) noexcept {
+    __stack_size_ = __size;
+    return *this;
+  }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI size_t stack_size() const noexcept { return __stack_size_; }
+
+  // Restricts the thread to the CPUs added. Without any, the thread may run on every CPU.
+  _LIBCPP_HIDE_FROM_ABI thread_attributes& add_cpu(size_t __cpu) noexcept {
+    _LIBCPP_ASSERT_VALID_INPUT_RANGE(__cpu < max_cpus, "thread_attributes::add_cpu: the CPU index is out of range");
+    __cpus_[__cpu / __bits_per_word] |= uint64_t(1) << (__cpu % __bits_per_word);
+    __has_affinity_ = true;
+    return *this;
+  }
+  _LIBCPP_HIDE_FROM_ABI thread_attributes& clear_cpus() noexcept {
+    for (uint64_t& __w : __cpus_)
+      __w = 0;
+    __has_affinity_ = false;
+    return *this;
+  }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI bool has_cpu(size_t __cpu) const noexcept {
+    return __cpu < max_cpus && (__cpus_[__cpu / __bits_per_word] >> (__cpu % __bits_per_word)) & 1;
+  }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI bool has_affinity() const noexcept { return __has_affinity_; }
+
+  // __policy is one of the SCHED_* policies, and __priority a priority valid for it, as in sched_param.
+  _LIBCPP_HIDE_FROM_ABI thread_attributes& set_scheduling(int __policy, int __priority) noexcept {
+    __policy_         = __policy;
+    __priority_       = __priority;
+    __has_scheduling_ = true;
+    return *this;
+  }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI bool has_scheduling() const noexcept { return __has_scheduling_; }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI int policy() const noexcept { return __policy_; }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI int priority() const noexcept { return __priority_; }
+
+  // Names longer than max_name_size are truncated.
+  _LIBCPP_HIDE_FROM_ABI thread_attributes& set_name(const char* __name) noexcept {
+    size_t __i = 0;
+    for (; __i != max_name_size && __name[__i] != '\0'; ++__i)
+      __name_[__i] = __name[__i];
+    __name_[__i] = '\0';
+    return *this;
+  }
+  [[nodiscard]] _LIBCPP_HIDE_FROM_ABI const char* name() const noexcept { return __name_; }
+
+  // Creates a thread with these attributes, except for the name, in the manner of __libcpp_thread_create.
+  _LIBCPP_HIDE_FROM_ABI int __create_thread(__libcpp_thread_t* __t, void* (*__func)(void*), void* __arg) const {
+#    if _LIBCPP_HAS_THREAD_API_PTHREAD
+    pthread_attr_t __attr;
+    int __ec = pthread_attr_init(&__attr);
+    if (__ec != 0)
+      return __ec;
+    __ec = __apply(&__attr);
+    if (__ec == 0)
+      __ec = pthread_create(__t, &__attr, __func, __arg);
+    pthread_attr_destroy(&__attr);
+    return __ec;
+#    else
+    if (__stack_size_ != 0 || __has_affinity_ || __has_scheduling_)
+      return ENOTSUP;
+    return std::__libcpp_thread_create(__t, __func, __arg);
+#    endif
+  }
+
+  // Names the calling thread, on the platforms which support it.
+  _LIBCPP_HIDE_FROM_ABI static void __set_current_thread_name(const char* __name) noexcept {
+    if (__name[0] == '\0')
+      return;
+#    if _LIBCPP_HAS_THREAD_API_PTHREAD && defined(__APPLE__)
+    pthread_setname_np(__name);
+#    elif _LIBCPP_HAS_THREAD_API_PTHREAD && (defined(__GLIBC__) || defined(__BIONIC__))
+    // Linux limits the names to 15 characters, and fails on longer ones.
+    char __short_name[16];
+    size_t __i = 0;
+    for (; __i != 15 && __name[__i] != '\0'; ++__i)
+      __short_name[__i] = __name[__i];
+    __short_name[__i] = '\0';
+    pthread_setname_np(pthread_self(), __short_name);
+#    endif
+  }
+
+private:
+  static constexpr size_t __bits_per_word = 64;
+
+#    if _LIBCPP_HAS_THREAD_API_PTHREAD
+  _LIBCPP_HIDE_FROM_ABI int __apply(pthread_attr_t* __attr) const {
+    int __ec = 0;
+    if (__stack_size_ != 0) {
+      __ec = pthread_attr_setstacksize(__attr, __stack_size_);
+      if (__ec != 0)
+        return __ec;
+    }
+    if (__has_scheduling_) {
+      sched_param __param    = {};
+      __param.sched_priority = __priority_;
+      if ((__ec = pthread_attr_setinheritsched(__attr, PTHREAD_EXPLICIT_SCHED)) != 0 ||
+          (__ec = pthread_attr_setschedpolicy(__attr, __policy_)) != 0 ||
+          (__ec = pthread_attr_setschedparam(__attr, &__param)) != 0)
+        return __ec;
+    }
+    if (__has_affinity_) {
+#      if defined(__GLIBC__) && defined(CPU_SETSIZE)
+      cpu_set_t __set;
+      CPU_ZERO(&__set);
+      for (size_t __cpu = 0; __cpu != max_cpus && __cpu < CPU_SETSIZE; ++__cpu)
+        if (has_cpu(__cpu))
+          CPU_SET(__cpu, &__set);
+      __ec = pthread_attr_setaffinity_np(__attr, sizeof(__set), &__set);
+#      else
+      __ec = ENOTSUP;
+#      endif
+    }
+    return __ec;
+  }
+#    endif // _LIBCPP_HAS_THREAD_API_PTHREAD
+
+  size_t __stack_size_                         = 0;
+  int __policy_                                = 0;
+  int __priority_                              = 0;
+  bool __has_scheduling_                       = false;
+  bool __has_affinity_                         = false;
+  uint64_t __cpus_[max_cpus / __bits_per_word] = {};
+  char __name_[max_name_size + 1]              = {};
+};
+
+template <>
+struct __is_thread_attributes<thread_attributes> : true_type {};
+
+// The function run by a thread created with a thread_attributes, which names the thread before calling the user's
+// function.
+template <class _Fp>
+struct __named_thread_function {
+  char __name_[thread_attributes::max_name_size + 1];
+  _Fp __f_;
+
+  template <class _Up>
+  _LIBCPP_HIDE_FROM_ABI __named_thread_function(const thread_attributes& __attrs, _Up&& __f)
+      : __f_(std::forward<_Up>(__f)) {
+    const char* __name = __attrs.name();
+    size_t __i         = 0;
+    for (; __name[__i] != '\0'; ++__i)
+      __name_[__i] = __name[__i];
+    __name_[__i] = '\0';
+  }
+
+  template <class... _Args>
+  _LIBCPP_HIDE_FROM_ABI void operator()(_Args&&... __args) {
+    thread_attributes::__set_current_thread_name(__name_);
+    std::__invoke(std::move(__f_), std::forward<_Args>(__args)...);
+  }
+};
+
+#  endif // _LIBCPP_STD_VER >= 17 && _LIBCPP_HAS_EXPERIMENTAL_THREAD_ATTRIBUTES
+
+#endif // _LIBCPP_HAS_THREADS
+
+_LIBCPP_END_NAMESPACE_STD
+
+_LIBCPP_POP_MACROS
+
+#endif // _LIBCPP___THREAD_THREAD_ATTRIBUTES_H
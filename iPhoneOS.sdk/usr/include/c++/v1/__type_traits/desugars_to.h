@@ -31,6 +31,24 @@ struct __less_tag {};
 // syntactically, the operation is equivalent to calling `a > b`
 struct __greater_tag {};
 
+// syntactically, the operation is equivalent to calling `a & b`
+struct __bit_and_tag {};
+
+// syntactically, the operation is equivalent to calling `a | b`
+struct __bit_or_tag {};
+
+// syntactically, the operation is equivalent to calling `a ^ b`
+struct __bit_xor_tag {};
+
+// syntactically, the operation is equivalent to calling `a && b`
+struct __logical_and_tag {};
+
+// syntactically, the operation is equivalent to calling `a || b`
+struct __logical_or_tag {};
+
+// syntactically, the operation is equivalent to calling `!a`
+struct __logical_not_tag {};
+
 // syntactically, the operation is equivalent to calling `a < b`, and these expressions
 // have to be true for any `a` and `b`:
 // - `(a < b) == (b > a)`